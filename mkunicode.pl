@@ -0,0 +1,175 @@
+#!/usr/bin/env perl
+# $Id: mkunicode.pl,v 1.1 2026/10/18 12:00:00 bbonev Exp $
+#
+# Copyright © 2015-2026 Boian Bonev (bbonev@ipacct.com) {{{
+#
+# SPDX-License-Identifer: LGPL-3.0-or-later
+#
+# This file is part of yascreen - yet another screen library.
+#
+# yascreen is free software, released under the terms of GNU Lesser General Public License v3.0 or later
+# }}}
+
+# generate yascreen_unicode.c - display width and grapheme break property of unicode code points
+#
+# usage: perl mkunicode.pl > yascreen_unicode.c
+#
+# the data comes from Unicode::UCD of the perl that runs the script
+# control chars and surrogates are handled in code, not in the table
+
+use strict;
+use warnings;
+use Unicode::UCD qw(prop_invmap prop_invlist);
+
+use constant {W_ZERO=>0,W_NARROW=>1,W_WIDE=>2,W_AMBI=>3};
+
+# grapheme break property values, extended pictographic is folded in as a value of its own
+my @GB=qw(Other CR LF Control Extend ZWJ Regional_Indicator Prepend SpacingMark L V T LV LVT ExtPict);
+my %GB;
+@GB{@GB}=(0..$#GB);
+
+sub expand { # {{{
+	# expand an inversion map into a per code point array
+	my ($prop)=@_;
+	my ($list,$map)=prop_invmap($prop);
+	my @r;
+
+	for (my $i=0;$i<@$list;$i++) {
+		my $end=$i+1<@$list?$list->[$i+1]:0x110000;
+
+		$r[$_]=$map->[$i] for ($list->[$i]..$end-1);
+	}
+	return @r;
+} # }}}
+
+sub inlist { # {{{
+	# expand an inversion list into a per code point array of flags
+	my ($prop)=@_;
+	my @list=prop_invlist($prop);
+	my @r=(0)x0x110000;
+
+	for (my $i=0;$i<@list;$i+=2) {
+		my $end=$i+1<@list?$list[$i+1]:0x110000;
+
+		$r[$_]=1 for ($list[$i]..$end-1);
+	}
+	return @r;
+} # }}}
+
+my @cat=expand('General_Category');
+my @eaw=expand('East_Asian_Width');
+my @gcb=expand('Grapheme_Cluster_Break');
+my @pcm=inlist('Prepended_Concatenation_Mark'); # format chars that are displayed
+my @pict=inlist('Extended_Pictographic');
+
+sub width { # {{{
+	my ($cp)=@_;
+	my $cat=$cat[$cp];
+
+	return W_ZERO if $cat eq 'Mn'||$cat eq 'Me'||($cat eq 'Cf'&&!$pcm[$cp]&&$cp!=0xad);
+	return W_ZERO if ($cp>=0x1160&&$cp<=0x11ff)||($cp>=0xd7b0&&$cp<=0xd7ff); # hangul jamo vowels and final consonants join the previous syllable
+	return W_WIDE if $eaw[$cp] eq 'W'||$eaw[$cp] eq 'F';
+	return W_WIDE if ($cp>=0x20000&&$cp<=0x2fffd)||($cp>=0x30000&&$cp<=0x3fffd); # unassigned code points in these planes are wide by default
+	return W_AMBI if $eaw[$cp] eq 'A';
+	return W_NARROW;
+} # }}}
+
+sub gb { # {{{
+	my ($cp)=@_;
+
+	if ($pict[$cp]) { # perl reports these as ExtPict_XX
+		die sprintf("extended pictographic U+%04X has grapheme break %s\n",$cp,$gcb[$cp]) if $gcb[$cp] ne 'Other'&&$gcb[$cp] ne 'ExtPict_XX';
+		return $GB{ExtPict};
+	}
+	die sprintf("unknown grapheme break %s of U+%04X\n",$gcb[$cp],$cp) unless exists $GB{$gcb[$cp]};
+	return $GB{$gcb[$cp]};
+} # }}}
+
+sub split_blocks { # {{{
+	# split data in blocks of 1<<bits entries, returning unique blocks and index of each block
+	my ($data,$bits)=@_;
+	my $size=1<<$bits;
+	my (@blocks,@index,%seen);
+
+	for (my $i=0;$i<@$data;$i+=$size) {
+		my $b=join(',',@$data[$i..$i+$size-1]);
+
+		unless (exists $seen{$b}) {
+			$seen{$b}=@blocks;
+			push @blocks,[@$data[$i..$i+$size-1]];
+		}
+		push @index,$seen{$b};
+	}
+	return (\@blocks,\@index);
+} # }}}
+
+sub ctype { # {{{
+	return $_[0]<256?'uint8_t':'uint16_t';
+} # }}}
+
+sub carray { # {{{
+	my ($name,$type,$data,$per)=@_;
+	my $out=sprintf("static const %s %s[%d]={\n",$type,$name,scalar @$data);
+
+	$per||=16;
+	for (my $i=0;$i<@$data;$i+=$per) {
+		my $e=$i+$per<@$data?$i+$per:@$data;
+
+		$out.="\t".join(',',@$data[$i..$e-1]).",\n";
+	}
+	return $out."};\n";
+} # }}}
+
+# one byte per code point: width in bits 0-1, grapheme break in bits 2-5
+my @prop=map {width($_)|gb($_)<<2} (0..0x10ffff);
+
+my @best;
+for my $lbits (2..9) { # leaf blocks of property bytes
+	my ($leaves,$lidx)=split_blocks(\@prop,$lbits);
+
+	for my $mbits (2..16-$lbits) { # middle blocks of leaf indexes, 0x110000 splits evenly up to 16 bits
+		my ($mids,$midx)=split_blocks($lidx,$mbits);
+		my $size=@$leaves<<$lbits;
+
+		$size+=(@$mids<<$mbits)*(@$leaves<256?1:2);
+		$size+=@$midx*(@$mids<256?1:2);
+		@best=($size,$lbits,$mbits) if !@best||$size<$best[0];
+	}
+}
+
+my ($size,$lbits,$mbits)=@best;
+my ($leaves,$lidx)=split_blocks(\@prop,$lbits);
+my ($mids,$midx)=split_blocks($lidx,$mbits);
+
+print "// \$Id: yascreen_unicode.c,v 1.1 2026/10/18 12:00:00 bbonev Exp \$\n";
+print "//\n";
+printf "// generated by mkunicode.pl from unicode %s data, do not edit\n",Unicode::UCD::UnicodeVersion();
+print "//\n";
+print "// Copyright © 2015-2026 Boian Bonev (bbonev\@ipacct.com) {{{\n";
+print "//\n";
+print "// SPDX-License-Identifer: LGPL-3.0-or-later\n";
+print "//\n";
+print "// This file is part of yascreen - yet another screen library.\n";
+print "//\n";
+print "// yascreen is free software, released under the terms of GNU Lesser General Public License v3.0 or later\n";
+print "// }}}\n";
+print "\n";
+print "// property of a code point is a byte: bits 0-1 width (0 - zero width, 1 - narrow, 2 - wide, 3 - east asian ambiguous)\n";
+print "// bits 2-5 grapheme cluster break (YAS_GB_*)\n";
+printf "// code point bits: %d top index, %d middle index, %d leaf byte; %d bytes in total\n",21-$lbits-$mbits,$mbits,$lbits,$size;
+print "\n";
+for (my $i=0;$i<@GB;$i++) {
+	my $n=uc $GB[$i];
+
+	$n='RI' if $n eq 'REGIONAL_INDICATOR';
+	printf "#define YAS_GB_%s %d\n",$n,$i;
+}
+print "\n";
+printf "#define YAS_UP_LBITS %d\n",$lbits;
+printf "#define YAS_UP_MBITS %d\n",$mbits;
+print "\n";
+print carray('yas_up_top',ctype(scalar @$mids),$midx);
+print "\n";
+print carray('yas_up_mid',ctype(scalar @$leaves),[map {@$_} @$mids]);
+print "\n";
+print carray('yas_up_leaf','uint8_t',[map {@$_} @$leaves]);
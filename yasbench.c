@@ -0,0 +1,179 @@
+#include <time.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <inttypes.h>
+
+#include <yascreen.h>
+
+// benchmarks for yascreen; each prints the time per operation
+
+static double now(void) {
+	struct timespec t;
+
+	clock_gettime(CLOCK_MONOTONIC,&t);
+	return t.tv_sec+t.tv_nsec/1e9;
+}
+
+#ifdef __GLIBC__ // count heap operations by wrapping the allocator
+#define HAVE_ALLOCS 1
+
+extern void *__libc_malloc(size_t size);
+extern void *__libc_calloc(size_t nmemb,size_t size);
+extern void *__libc_realloc(void *ptr,size_t size);
+extern void __libc_free(void *ptr);
+#endif
+
+static long allocs; // calls to malloc, calloc and realloc
+static long frees; // calls to free with non-NULL
+
+#if HAVE_ALLOCS
+void *malloc(size_t size) {
+	allocs++;
+	return __libc_malloc(size);
+}
+
+void *calloc(size_t nmemb,size_t size) {
+	allocs++;
+	return __libc_calloc(nmemb,size);
+}
+
+void *realloc(void *ptr,size_t size) {
+	allocs++;
+	return __libc_realloc(ptr,size);
+}
+
+void free(void *ptr) {
+	if (ptr)
+		frees++;
+	__libc_free(ptr);
+}
+#endif
+
+static size_t outlen; // bytes sent by out_null
+
+static ssize_t out_null(yascreen *s,const void *data,size_t len) {
+	(void)s;
+	(void)data;
+	outlen+=len;
+	return len;
+}
+
+static int bench_init(int sx,int sy) {
+	// session startup: init and free, as done on every telnet session accept
+	int i,n=1000;
+	long a=allocs;
+	double t=now();
+
+	for (i=0;i<n;i++) {
+		yascreen *s=yascreen_init(sx,sy);
+
+		if (!s) {
+			printf("couldn't init screen %dx%d\n",sx,sy);
+			return 1;
+		}
+		yascreen_setout(s,out_null);
+		yascreen_free(s);
+	}
+	t=now()-t;
+	printf("init %dx%d: %d sessions %.3fs (%.1fus each, %ld allocs each)\n",sx,sy,n,t,t*1e6/n,(allocs-a)/n);
+	return 0;
+}
+
+static int bench_diff(int pct,const char *name) {
+	// full screen updates of a wide terminal with pct% of the cells changed at random positions
+	// pct 0 changes one cell in each line, so the time is spent mostly in the row comparison
+	int sx=400,sy=120,n=2000,i,k,y;
+	double t=0,t0;
+	char c[2]="a";
+	yascreen *s=yascreen_init(sx,sy);
+
+	if (!s) {
+		printf("couldn't init screen %dx%d\n",sx,sy);
+		return 1;
+	}
+	yascreen_setout(s,out_null);
+	srand(1); // the same changes for each row comparison
+	for (y=0;y<sy;y++)
+		yascreen_printxy(s,0,y,0,"%*s",sx,"line text line text");
+	yascreen_update(s);
+	outlen=0;
+	for (i=0;i<n;i++) {
+		if (!pct)
+			for (y=0;y<sy;y++) {
+				c[0]='a'+rand()%26;
+				yascreen_putsxy(s,rand()%sx,y,0,c);
+			}
+		for (k=0;k<sx*sy*pct/100;k++) {
+			c[0]='a'+rand()%26;
+			yascreen_putsxy(s,rand()%sx,rand()%sy,0,c);
+		}
+		t0=now();
+		yascreen_update(s);
+		t+=now()-t0;
+	}
+	printf("diff %dx%d %d%% changes%s%s: %.1fus per update (%zu bytes out)\n",sx,sy,pct,name?" ":"",name?name:"",t*1e6/n,outlen);
+	yascreen_free(s);
+	return 0;
+}
+
+static int bench_print(void) {
+	// steady state formatted printing should not touch the heap
+	int n=1000000,i;
+	long a,f;
+	double t;
+	yascreen *s=yascreen_init(80,25);
+
+	if (!s) {
+		printf("couldn't init screen %dx%d\n",80,25);
+		return 1;
+	}
+	yascreen_setout(s,out_null);
+	for (i=0;i<100;i++) // warm up
+		yascreen_printxy(s,0,0,0,"%d",i);
+	a=allocs;
+	f=frees;
+	t=now();
+	for (i=0;i<n;i++) {
+		yascreen_printxy(s,i%70,i%25,0,"%d",i);
+		if (!(i%4))
+			yascreen_printxyu(s,0,i%25,0,"val %5d %-8s|",i,"abc");
+		if (!(i%4))
+			yascreen_print(s,"%d",i);
+	}
+	t=now()-t;
+	#if HAVE_ALLOCS
+	printf("print: %d calls %.1fns each, %ld allocs %ld frees\n",n+n/2,t*1e9/(n+n/2),allocs-a,frees-f);
+	#else
+	printf("print: %d calls %.1fns each, allocation counting needs glibc\n",n+n/2,t*1e9/(n+n/2));
+	#endif
+	yascreen_free(s);
+	return 0;
+}
+
+static int usage(void) {
+	printf("usage: yasbench init [sx sy]\n");
+	printf("       yasbench diff [pct [name]]\n");
+	printf("       yasbench print\n");
+	printf("\tinit - 1000 x yascreen_init+yascreen_free, default size is 400x120\n");
+	printf("\tdiff - 2000 x yascreen_update of 400x120 with pct%% (default 5) random cells changed, 0 changes one cell in each line\n");
+	printf("\t       name is printed with the result, e.g. the row comparison the binary is built with\n");
+	printf("\tprint - yascreen_printxy, yascreen_printxyu and yascreen_print with heap operations counted\n");
+	return 1;
+}
+
+int main(int argc,char **argv) {
+	if (argc<2)
+		return usage();
+	if (!strcmp(argv[1],"init")) {
+		if (argc==4)
+			return bench_init(atoi(argv[2]),atoi(argv[3]));
+		return bench_init(400,120);
+	}
+	if (!strcmp(argv[1],"diff"))
+		return bench_diff(argc>2?atoi(argv[2]):5,argc>3?argv[3]:NULL);
+	if (!strcmp(argv[1],"print"))
+		return bench_print();
+	return usage();
+}
@@ -1,4 +1,4 @@
-// $Id: yascreen.c,v 2.14 2026/07/21 08:18:02 bbonev Exp $
+// $Id: yascreen.c,v 2.15 2026/10/18 12:00:00 bbonev Exp $
 //
 // Copyright © 2015-2026 Boian Bonev (bbonev@ipacct.com) {{{
 //
@@ -20,18 +20,30 @@
 
 #include <time.h>
 #include <errno.h>
+#include <limits.h>
 #include <wchar.h>
 #include <stdio.h>
 #include <stdarg.h>
 #include <stdlib.h>
 #include <string.h>
 #include <unistd.h>
+#include <fcntl.h>
+#include <signal.h>
 #include <termios.h>
 #include <sys/time.h>
 #include <sys/ioctl.h>
 
 #include <yascreen.h>
 
+#ifndef YASCREEN_DIFF // row comparison: 0 - selected by cpu features, 1 - generic, 2 - sse2, 3 - avx2 if the cpu has it (for benchmarks)
+#define YASCREEN_DIFF 0
+#endif
+
+#if defined(__GNUC__)&&(defined(__x86_64__)||defined(__i386__))&&defined(__SSE2__)&&YASCREEN_DIFF!=1
+#define YAS_X86_SIMD 1 // vectorized row comparison with SSE2 baseline and AVX2 selected at runtime
+#include <immintrin.h>
+#endif
+
 // }}}
 
 // {{{ definitions
@@ -41,23 +53,39 @@
 
 #define ESC "\x1b"
 
-// size of string that can be stored immediately w/o allocation
-#define PSIZE (sizeof(char *))
+// initial size of the cluster table and its hash
+#define CLUSTEP 64
 // step to allocate key buffer
 #define KEYSTEP (4096/sizeof(int))
+// step to allocate mouse event buffer
+#define MOUSESTEP (4096/sizeof(yas_mouse))
+// step to allocate scroll queue
+#define SCROLLSTEP 16
+// step to allocate the formatting buffer
+#define FMTSTEP 256
+// minimal runs of blanks that are erased on update instead of printed, up to the end of the line (EL) and inside it (ECH)
+// ECH does not move the cursor, so it has to be positioned again after it
+#define YAS_EL_MIN 4
+#define YAS_ECH_MIN 16
 // default timeout in milliseconds before escape is returned
 #define YAS_DEFAULT_ESCTO 300
 // timeout in milliseconds to eat an LF/NUL combination after CR
 #define YAS_ENTER_TO 300
+// time in milliseconds without SIGWINCH before a screen size change is reported
+#define YAS_WINCH_TO 100
 
 // check if a given value is a valid simple color value
 #define YAS_ISCOLOR(c) ((c)>=8&&(c)<=15)
 // check if a given value is a valid extended color value
 #define YAS_ISXCOLOR(c) ((c)&0x100)
 
-#define YAS_STORAGE 0x80000000 // data is longer than PSIZE and is stored in allocated memory
-#define YAS_TOUCHED 0x40000000 // there are changes in this line, update cannot skip it
-#define YAS_INTERNAL (YAS_STORAGE|YAS_TOUCHED)
+#define YAS_RESERVED 0xc0000000 // kept for internal flags, callers may not set it just like YAS_WTAIL
+#define YAS_WTAIL 0x20000000 // tail cell of a wide character, holds no content
+#define YAS_INTERNAL (YAS_RESERVED|YAS_WTAIL)
+
+#define YAS_GLYPH_ID 0x80000000 // glyph is an index in the cluster table, otherwise it is a codepoint; 0 is a space
+#define YAS_GLYPH_ERR 0xffffffff // glyph could not be stored
+#define YAS_GLYPH_MAX 0x7ffffff0 // limit of cluster table entries
 
 #define TELNET_EOSN 240 // 0xf0 // end of subnegotiation
 #define TELNET_NOP 241 // 0xf1 // NOP
@@ -81,17 +109,31 @@
 
 #define TELNET_NAWS 31 // 0x1f // negotiate about window size
 
-// data is kept as utf8, including its combining chars
-// if it fits in PSZIE, it is in d, with 0 terminating char
-// if the char at previous position requires 2 columns, current char should be empty
-// after initialization all chars are set to ' ' (0x20)
-typedef struct _cell {
-	uint32_t style; // color, style and storage type
-	union {
-		char *p;
-		char d[PSIZE];
-	};
-} cell;
+// each cell is a style and a glyph at the same offset; lines are stored in slots of pitch cells
+// glyph 0 is a blank, a single codepoint is stored as is and anything else (combining chars, zwj
+// sequences) is an index in the cluster table marked with YAS_GLYPH_ID
+// a wide char is followed by a tail cell with the same style plus YAS_WTAIL and glyph 0
+// slot 0 is the blank row with default style, a line is moved to its own slot on the first write
+typedef struct _cbuf { // screen buffer, stored as separate arrays so that rows of styles and glyphs are dense
+	uint32_t *style; // color and style
+	uint32_t *glyph; // content - a codepoint or a cluster table index (YAS_GLYPH_ID)
+	uint32_t *row; // slot that holds each line; slot 0 is a blank line shared by all blank lines and is never written
+	uint32_t *freeslot; // stack of unused slots
+	uint32_t nfree; // number of unused slots
+} cbuf;
+
+typedef struct _yas_scroll { // terminal scroll queued for the next update
+	int x1,x2; // first and last column of the scroll region
+	int y1,y2; // first and last line of the scroll region
+	int n; // lines to scroll up, down if negative
+} yas_scroll;
+
+typedef struct _cluster { // content of a cell that is not a single codepoint, shared by all cells that show it
+	char *str;
+	uint32_t ref; // number of cells that use it; 0 for a free entry
+	uint32_t hash;
+	uint32_t next; // next entry in the same hash chain or in the free list
+} cluster;
 
 typedef enum { // ansi sequence state machine
 	ST_NORM, // normal input, check for ESC
@@ -104,8 +146,22 @@ typedef enum { // ansi sequence state machine
 	ST_ESC_O, // escape O sequence
 	ST_ESC_O_D, // escape O digit sequence (old xterm modified F1-F4 and arrows)
 	ST_ESC_ESC, // escape escape sequence
+	ST_PASTE, // bracketed paste payload, collect until \e[201~
 } yas_k_state;
 
+typedef enum { // payload that belongs to a saved key
+	KP_NONE, // plain key, also keys put back by the application
+	KP_MOUSE, // YAS_MOUSE, the event is the oldest one in mice
+	KP_PASTE, // YAS_PASTE, the data is the oldest one in pastes
+} yas_kp;
+
+// pastes are collected as a whole and queued until retrieved by the application
+typedef struct _paste {
+	struct _paste *next; // next queued paste
+	char *data; // paste payload, not zero terminated
+	size_t len; // payload length
+} paste;
+
 typedef enum { // telnet sequence state machine
 	T_NORM, // expect regular byte or IAC
 	T_IAC, // telnet IAC, expect option
@@ -133,21 +189,68 @@ typedef enum { // utf8 sequence state machine
 	U_L6C5, // expect 5/5 continuation bytes
 } yas_u_state;
 
+typedef struct _yas_gc { // grapheme cluster collected while decoding a string
+	char *str; // utf8 of the cluster, zero terminated; points to sb unless it is longer
+	size_t len; // length of str
+	size_t size; // allocated size of str
+	int width; // display width of the cluster
+	uint8_t first; // grapheme break property of the first codepoint (YAS_GB_*)
+	uint8_t last; // grapheme break property of the last codepoint
+	uint8_t ri; // number of trailing regional indicators
+	uint8_t emoji:1; // extended pictographic followed by extend chars, may be joined by zwj
+	uint8_t measure:1; // only measure the clusters, do not put them on screen
+	uint8_t full:1; // measuring reached limit
+	size_t at; // offset in the string of the last byte that is decoded
+	size_t pos; // offset in the string of the cluster
+	int total; // measuring: width of the clusters so far
+	int room; // measuring: set cut at the first cluster that exceeds this width
+	int limit; // measuring: set end and stop at the first cluster that exceeds this width
+	size_t cut; // offset of the first cluster exceeding room, -1 if not yet
+	size_t end; // offset of the first cluster exceeding limit
+	char sb[64];
+} yas_gc;
+
 struct _yascreen {
 	int sx,sy; // size of screen
 	ssize_t (*outcb)(yascreen *s,const void *data,size_t len); // output callback
-	cell *mem; // memory state
-	cell *scr; // screen state
+	cbuf mem; // memory state
+	cbuf scr; // screen state
+	int pitch; // cells in a slot, at least sx
+	uint32_t nslot; // slots in each buffer, at least sy+1 so that every line can have its own
+	uint8_t *touched; // there are changes in the line, update cannot skip it
+	yas_scroll *scrolls; // scrolls queued for the next update, scr is already scrolled
+	int scrollsize; // allocated entries in scrolls
+	int scrollcnt; // queued scrolls
+	cluster *clu; // cluster table, entry 0 is not used
+	uint32_t clusize; // allocated entries in clu
+	uint32_t clucnt; // entries in clu that were ever used
+	uint32_t clulive; // entries in clu that are in use
+	uint32_t clufree; // head of the list of free entries in clu
+	uint32_t *cluhash; // heads of the hash chains in clu
+	uint32_t cluhsize; // size of cluhash, power of 2
 	struct termios *tsstack; // saved terminal state
 	int tssize; // number of items in the stack
 	int escto; // single ESC key timeout (in milliseconds)
 	int keysize; // saved key storage size
 	int keycnt; // saved key count
 	int *keys; // saved key array
-	unsigned char ansibuf[21]; // buffer for escape sequence parsing
+	int64_t *keyts; // arrival time of saved keys
+	uint8_t *keyp; // payload of saved keys (KP_*)
+	char *pbuf; // bracketed paste being collected
+	size_t plen; // collected paste length
+	size_t psize; // allocated paste buffer size
+	paste *pastes; // completed pastes, oldest first
+	paste *pastel; // last completed paste
+	paste *pastecur; // pastes of retrieved keys, the latest first; freed when the next paste is retrieved
+	int micesize; // saved mouse event storage size
+	int micecnt; // saved mouse event count
+	yas_mouse *mice; // saved mouse events, one for each KP_MOUSE key in the key buffer
+	yas_mouse mousecur; // mouse event of the last retrieved KP_MOUSE key
+	unsigned char ansibuf[40]; // buffer for escape sequence parsing; csi u with alternate keys may be 30 bytes
 	unsigned char ansipos; // next byte will go in this pos
 	unsigned char sosnbuf[20]; // buffer for telnet SOSN options parsing
 	unsigned char sosnpos; // next byte will go in this pos
+	unsigned char pendpos; // matched bytes of the paste end marker
 	unsigned char utf[3]; // buffer for utf8 sequence parsing; last byte is not put here, its never zero terminated
 						// must be increased to 4 or 5 if some day unicode permits 5 or 6 byte sequences
 	int64_t escts; // single ESC key timestamp
@@ -165,10 +268,27 @@ struct _yascreen {
 	uint8_t cursor:1; // last cursor state
 	uint8_t redraw:1; // flag to redraw from scratch
 	uint8_t lineflush:1; // always flush after line operations
+	uint8_t kbd:2; // enabled keyboard protocols (YAS_KBD_*)
+	uint8_t ispaste:1; // bracketed paste mode is enabled
+	uint8_t plost:1; // part of the paste being collected could not be stored
+	uint8_t havemouse:1; // mousecur is not returned by yascreen_getmouse yet
+	uint8_t havepaste:1; // the head of pastecur is not returned by yascreen_getpaste yet
+	uint8_t mouse:2; // mouse tracking mode
+	uint8_t caps:3; // terminal capabilities (YAS_CAP_*)
+	uint8_t clearpend:1; // mem was cleared since the last full update, the terminal may be erased instead of repainted
+	uint8_t ambiwide:1; // east asian ambiguous width chars are wide
+	uint8_t winch:1; // built-in SIGWINCH handling is enabled
+	uint8_t winchpend:1; // SIGWINCH is received, screen size change is not reported yet
+	uint8_t storage:1; // some cells may hold clusters
+	sig_atomic_t winchgen; // last seen SIGWINCH counter
+	int64_t winchts; // last SIGWINCH timestamp
 	int hint; // user defined hint (scalar)
 	void *phint; // user defined hint (pointer)
 	uint8_t outb[256]; // buffered output
 	uint16_t outp; // position in outb
+	uint32_t clearattr; // attr of the last clear of mem
+	char *fmtb; // formatted output of printxy and friends, reused between calls
+	size_t fmtsize; // allocated size of fmtb
 };
 
 // helpers for versioned symbols
@@ -194,6 +314,28 @@ struct _yascreen {
 
 // }}}
 
+// SIGWINCH is process wide, so its state is shared by all screens
+static int winchpipe[2]={-1,-1}; // self-pipe to wake up the event loop
+static int winchusers; // number of screens with built-in SIGWINCH handling
+static volatile sig_atomic_t winchcnt; // number of received SIGWINCH signals
+static struct sigaction winchold; // SIGWINCH action before the handler was installed
+
+static void yascreen_winch_handler(int sig,siginfo_t *info,void *ctx) { // {{{
+	int e=errno;
+	ssize_t wr;
+
+	winchcnt++;
+	wr=write(winchpipe[1],"",1); // if the pipe is full, the event loop will wake up anyway
+	(void)wr;
+	// chain to the application handler of either kind
+	if (winchold.sa_flags&SA_SIGINFO) {
+		if (winchold.sa_sigaction)
+			winchold.sa_sigaction(sig,info,ctx);
+	} else if (winchold.sa_handler!=SIG_DFL&&winchold.sa_handler!=SIG_IGN)
+		winchold.sa_handler(sig);
+	errno=e;
+} // }}}
+
 static inline int64_t mytime() { // {{{
 	struct timespec ts;
 	int64_t res;
@@ -308,13 +450,38 @@ static inline void outs(yascreen *s,const char *str) { // {{{
 	outse(s,str,strlen(str));
 } // }}}
 
-static inline int yascreen_vasprintf(yascreen *s,char **ps,const char *format,va_list ap) { // {{{
+static inline int yascreen_vformat(yascreen *s,char **ps,const char *format,va_list ap) { // {{{
+	// format in the per-screen buffer; the result is valid until the next call
+	va_list aq;
+	size_t nsize;
+	char *nb;
+	int size;
+
 	if (!s)
 		return -1;
 	if (!format)
 		return -1;
 
-	return vasprintf(ps,format,ap);
+	va_copy(aq,ap);
+	size=vsnprintf(s->fmtb,s->fmtsize,format,aq);
+	va_end(aq);
+	if (size<0)
+		return -1;
+
+	if ((size_t)size>=s->fmtsize) { // grow and format again
+		nsize=((size_t)size/FMTSTEP+1)*FMTSTEP;
+		nb=(char *)realloc(s->fmtb,nsize);
+		if (!nb)
+			return -1;
+		s->fmtb=nb;
+		s->fmtsize=nsize;
+		size=vsnprintf(s->fmtb,s->fmtsize,format,ap);
+		if (size<0)
+			return -1;
+	}
+
+	*ps=s->fmtb;
+	return size;
 } // }}}
 
 static inline int outf(yascreen *s,const char *format,...) __attribute__((format(printf,2,3))); // {{{
@@ -326,15 +493,13 @@ static inline int outf(yascreen *s,const char *format,...) { // {{{
 	int size;
 
 	va_start(ap,format);
-	size=yascreen_vasprintf(s,&ns,format,ap);
+	size=yascreen_vformat(s,&ns,format,ap);
 	va_end(ap);
 
 	if (size==-1) // some error, nothing more to do
 		return -1;
 
 	outs(s,ns);
-
-	free(ns);
 	return 0;
 } // }}}
 
@@ -362,7 +527,7 @@ inline void *yascreen_get_hint_p(yascreen *s) { // {{{
 	return s->phint;
 } // }}}
 
-static char myver[]="\0Yet another screen library (https://github.com/bbonev/yascreen) $Revision: 2.14 $\n\n"; // {{{
+static char myver[]="\0Yet another screen library (https://github.com/bbonev/yascreen) $Revision: 2.15 $\n\n"; // {{{
 // }}}
 
 static inline void yascreen_ver_init(void) { // {{{
@@ -411,47 +576,376 @@ static inline void yascreen_auto_size(yascreen *s,int *sx,int *sy) { // {{{
 		}
 } // }}}
 
-static inline void yascreen_free_memcell(yascreen *s,size_t i) { // {{{
-	if (s->mem[i].style&YAS_STORAGE) {
-		free(s->mem[i].p);
-		s->mem[i].style&=~YAS_STORAGE;
+#include "yascreen_unicode.c"
+
+static inline uint8_t yascreen_uniprop(uint32_t cp) { // {{{
+	// property byte of a code point: width class in bits 0-1, grapheme break in bits 2-5
+	uint32_t p;
+
+	if (cp>0x10ffff)
+		return YAS_GB_CONTROL<<2;
+	p=yas_up_top[cp>>(YAS_UP_LBITS+YAS_UP_MBITS)];
+	p=yas_up_mid[(p<<YAS_UP_MBITS)|((cp>>YAS_UP_LBITS)&((1<<YAS_UP_MBITS)-1))];
+	return yas_up_leaf[(p<<YAS_UP_LBITS)|(cp&((1<<YAS_UP_LBITS)-1))];
+} // }}}
+
+static inline int yascreen_pwidth(yascreen *s,uint32_t cp,uint8_t p) { // {{{
+	// display width of a code point with property byte p; -1 for control chars and invalid code points
+	if (cp<0x20||(cp>=0x7f&&cp<0xa0)||(cp>=0xd800&&cp<0xe000)||cp>0x10ffff)
+		return -1;
+	if ((p&3)==3) // east asian ambiguous
+		return s->ambiwide?2:1;
+	return p&3;
+} // }}}
+
+static inline int yascreen_wcwidth(yascreen *s,uint32_t cp) { // {{{
+	// display width of a code point, independent of the locale
+	return yascreen_pwidth(s,cp,yascreen_uniprop(cp));
+} // }}}
+
+static inline int yascreen_utf8_enc(uint32_t cp,char *buf) { // {{{
+	// encode a codepoint in buf, that should have space for 5 bytes; returns the length
+	if (cp<0x80) {
+		buf[0]=cp;
+		buf[1]=0;
+		return 1;
+	}
+	if (cp<0x800) {
+		buf[0]=0xc0|(cp>>6);
+		buf[1]=0x80|(cp&0x3f);
+		buf[2]=0;
+		return 2;
+	}
+	if (cp<0x10000) {
+		buf[0]=0xe0|(cp>>12);
+		buf[1]=0x80|((cp>>6)&0x3f);
+		buf[2]=0x80|(cp&0x3f);
+		buf[3]=0;
+		return 3;
+	}
+	buf[0]=0xf0|((cp>>18)&0x07);
+	buf[1]=0x80|((cp>>12)&0x3f);
+	buf[2]=0x80|((cp>>6)&0x3f);
+	buf[3]=0x80|(cp&0x3f);
+	buf[4]=0;
+	return 4;
+} // }}}
+
+static inline uint32_t yascreen_utf8_cp(const char *str) { // {{{
+	// decode a string that holds exactly one codepoint in shortest form; returns 0 otherwise
+	const unsigned char *u=(const unsigned char *)str;
+	uint32_t cp;
+	char buf[5];
+	int l;
+
+	if (u[0]<0x80)
+		return u[0]&&!u[1]?u[0]:0;
+	if ((u[0]&0xe0)==0xc0)
+		l=2,cp=u[0]&0x1f;
+	else if ((u[0]&0xf0)==0xe0)
+		l=3,cp=u[0]&0x0f;
+	else if ((u[0]&0xf8)==0xf0)
+		l=4,cp=u[0]&0x07;
+	else
+		return 0;
+	if ((u[1]&0xc0)!=0x80)
+		return 0;
+	cp=(cp<<6)|(u[1]&0x3f);
+	if (l>2) {
+		if ((u[2]&0xc0)!=0x80)
+			return 0;
+		cp=(cp<<6)|(u[2]&0x3f);
+	}
+	if (l>3) {
+		if ((u[3]&0xc0)!=0x80)
+			return 0;
+		cp=(cp<<6)|(u[3]&0x3f);
+	}
+	if (u[l]||cp>0x10ffff) // trailing data or out of range
+		return 0;
+	if (yascreen_utf8_enc(cp,buf)!=l) // overlong encoding does not survive a round trip
+		return 0;
+	return cp;
+} // }}}
+
+static inline uint32_t yascreen_clu_hash(const char *str) { // {{{
+	uint32_t h=2166136261u; // FNV-1a
+
+	while (*str)
+		h=(h^(unsigned char)*str++)*16777619u;
+	return h;
+} // }}}
+
+static inline int yascreen_clu_rehash(yascreen *s,uint32_t size) { // {{{
+	uint32_t *nh,i;
+
+	nh=(uint32_t *)calloc(size,sizeof *nh);
+	if (!nh)
+		return -1;
+	for (i=1;i<s->clucnt;i++)
+		if (s->clu[i].ref) {
+			s->clu[i].next=nh[s->clu[i].hash&(size-1)];
+			nh[s->clu[i].hash&(size-1)]=i;
+		}
+	if (s->cluhash)
+		free(s->cluhash);
+	s->cluhash=nh;
+	s->cluhsize=size;
+	return 0;
+} // }}}
+
+static inline uint32_t yascreen_clu_add(yascreen *s,const char *str) { // {{{
+	// find or add a cluster and take a reference to it
+	uint32_t h=yascreen_clu_hash(str),i;
+	char *ns;
+
+	if (s->cluhsize)
+		for (i=s->cluhash[h&(s->cluhsize-1)];i;i=s->clu[i].next)
+			if (s->clu[i].hash==h&&!strcmp(s->clu[i].str,str)) {
+				s->clu[i].ref++;
+				return YAS_GLYPH_ID|i;
+			}
+	if (s->clulive>=s->cluhsize&&yascreen_clu_rehash(s,s->cluhsize?s->cluhsize*2:CLUSTEP))
+		return YAS_GLYPH_ERR;
+	if (!s->clufree&&s->clucnt>=s->clusize) {
+		cluster *nc;
+		uint32_t nsize=s->clusize?s->clusize*2:CLUSTEP;
+
+		if (nsize>YAS_GLYPH_MAX)
+			return YAS_GLYPH_ERR;
+		nc=(cluster *)realloc(s->clu,nsize*sizeof *nc);
+		if (!nc)
+			return YAS_GLYPH_ERR;
+		s->clu=nc;
+		s->clusize=nsize;
+		if (!s->clucnt) // entry 0 is not used, so that a glyph is never equal to YAS_GLYPH_ID
+			s->clucnt=1;
 	}
+	ns=strdup(str);
+	if (!ns)
+		return YAS_GLYPH_ERR;
+	if (s->clufree) {
+		i=s->clufree;
+		s->clufree=s->clu[i].next;
+	} else
+		i=s->clucnt++;
+	s->clu[i].str=ns;
+	s->clu[i].ref=1;
+	s->clu[i].hash=h;
+	s->clu[i].next=s->cluhash[h&(s->cluhsize-1)];
+	s->cluhash[h&(s->cluhsize-1)]=i;
+	s->clulive++;
+	s->storage=1;
+	return YAS_GLYPH_ID|i;
+} // }}}
+
+static inline void yascreen_glyph_ref(yascreen *s,uint32_t g) { // {{{
+	if (g&YAS_GLYPH_ID)
+		s->clu[g&~YAS_GLYPH_ID].ref++;
+} // }}}
+
+static inline void yascreen_glyph_unref(yascreen *s,uint32_t g) { // {{{
+	uint32_t i=g&~YAS_GLYPH_ID,*pi;
+
+	if (!(g&YAS_GLYPH_ID))
+		return;
+	if (--s->clu[i].ref)
+		return;
+	for (pi=&s->cluhash[s->clu[i].hash&(s->cluhsize-1)];*pi!=i;pi=&s->clu[*pi].next) // unlink from the hash chain
+		;
+	*pi=s->clu[i].next;
+	free(s->clu[i].str);
+	s->clu[i].str=NULL;
+	s->clu[i].next=s->clufree;
+	s->clufree=i;
+	s->clulive--;
+} // }}}
+
+static inline uint32_t yascreen_glyph_make(yascreen *s,const char *str) { // {{{
+	// encode the content of a cell; single codepoints are stored as is, a space as 0
+	uint32_t cp=yascreen_utf8_cp(str);
+
+	if (cp==' ')
+		return 0;
+	if (cp)
+		return cp;
+	return yascreen_clu_add(s,str);
+} // }}}
+
+static inline const char *yascreen_glyph_str(yascreen *s,uint32_t g,char *buf) { // {{{
+	// buf should have space for 5 bytes
+	if (!g)
+		return " ";
+	if (g&YAS_GLYPH_ID)
+		return s->clu[g&~YAS_GLYPH_ID].str;
+	yascreen_utf8_enc(g,buf);
+	return buf;
+} // }}}
+
+static inline const char *yascreen_cell_str(yascreen *s,cbuf *b,size_t i,char *buf) { // {{{
+	// a zeroed cell is a blank, so that buffers can be allocated lazily by calloc
+	if (b->style[i]&YAS_WTAIL&&!b->glyph[i])
+		return "";
+	return yascreen_glyph_str(s,b->glyph[i],buf);
+} // }}}
+
+static inline int yascreen_cbuf_alloc(cbuf *b,size_t n,uint32_t nslot) { // {{{
+	// resize the arrays of a buffer for n cells in nslot slots; on failure the buffer is left intact
+	uint32_t *style,*g,*row,*fs;
+
+	style=(uint32_t *)realloc(b->style,n*sizeof *style);
+	if (!style)
+		return -1;
+	b->style=style;
+	g=(uint32_t *)realloc(b->glyph,n*sizeof *g);
+	if (!g)
+		return -1;
+	b->glyph=g;
+	row=(uint32_t *)realloc(b->row,nslot*sizeof *row); // there are always less lines than slots
+	if (!row)
+		return -1;
+	b->row=row;
+	fs=(uint32_t *)realloc(b->freeslot,nslot*sizeof *fs);
+	if (!fs)
+		return -1;
+	b->freeslot=fs;
+	return 0;
+} // }}}
+
+static inline void yascreen_cbuf_free(cbuf *b) { // {{{
+	if (b->style)
+		free(b->style);
+	if (b->glyph)
+		free(b->glyph);
+	if (b->row)
+		free(b->row);
+	if (b->freeslot)
+		free(b->freeslot);
+} // }}}
+
+static inline void yascreen_cbuf_reset(yascreen *s,cbuf *b) { // {{{
+	// all lines share the blank slot, all other slots are unused
+	uint32_t sl;
+
+	memset(b->row,0,s->sy*sizeof *b->row);
+	b->nfree=0;
+	for (sl=s->nslot-1;sl>0;sl--) // lower slots are used first
+		b->freeslot[b->nfree++]=sl;
+	memset(b->style,0,s->sx*sizeof *b->style);
+	memset(b->glyph,0,s->sx*sizeof *b->glyph);
+} // }}}
+
+static inline int yascreen_grow(yascreen *s,int pitch,uint32_t nslot) { // {{{
+	// make space for nslot slots of pitch cells; the content is not moved
+	uint8_t *t;
+
+	if (yascreen_cbuf_alloc(&s->mem,(size_t)pitch*nslot,nslot)||yascreen_cbuf_alloc(&s->scr,(size_t)pitch*nslot,nslot))
+		return -1;
+	t=(uint8_t *)realloc(s->touched,nslot*sizeof *t);
+	if (!t)
+		return -1;
+	s->touched=t;
+	return 0;
+} // }}}
+
+static inline size_t yascreen_roff(yascreen *s,cbuf *b,int y) { // {{{
+	// offset of the first cell of a line for reading
+	return (size_t)b->row[y]*s->pitch;
 } // }}}
 
-static inline void yascreen_free_cell(yascreen *s,size_t i) { // {{{
-	yascreen_free_memcell(s,i);
-	if (s->scr[i].style&YAS_STORAGE) {
-		free(s->scr[i].p);
-		s->scr[i].style&=~YAS_STORAGE;
+static inline size_t yascreen_woff(yascreen *s,cbuf *b,int y) { // {{{
+	// offset of the first cell of a line for writing; a line in the blank slot gets a slot of its own
+	if (!b->row[y]) {
+		uint32_t sl=b->freeslot[--b->nfree]; // there are more slots than lines, so one is always free
+
+		memset(b->style+(size_t)sl*s->pitch,0,s->sx*sizeof *b->style);
+		memset(b->glyph+(size_t)sl*s->pitch,0,s->sx*sizeof *b->glyph);
+		b->row[y]=sl;
 	}
+	return (size_t)b->row[y]*s->pitch;
+} // }}}
+
+static inline void yascreen_blank_row(yascreen *s,cbuf *b,int y) { // {{{
+	// release the slot of a line, so that it is in the blank slot
+	size_t o=yascreen_roff(s,b,y);
+	int x;
+
+	if (!b->row[y])
+		return;
+	if (s->storage)
+		for (x=0;x<s->sx;x++)
+			yascreen_glyph_unref(s,b->glyph[o+x]);
+	b->freeslot[b->nfree++]=b->row[y];
+	b->row[y]=0;
+} // }}}
+
+static inline void yascreen_free_cells(yascreen *s,cbuf *b,size_t o,int cnt) { // {{{
+	// release the content of cnt cells starting at offset o, leaving blanks
+	int i;
+
+	if (s->storage)
+		for (i=0;i<cnt;i++)
+			yascreen_glyph_unref(s,b->glyph[o+i]);
+	memset(b->style+o,0,cnt*sizeof *b->style);
+	memset(b->glyph+o,0,cnt*sizeof *b->glyph);
+} // }}}
+
+static inline int yascreen_is_wtail(yascreen *s,size_t pos) { // {{{
+	return !!(s->mem.style[pos]&YAS_WTAIL);
 } // }}}
 
-static inline void yascreen_empty_cell(yascreen *s,size_t i) { // {{{
-	s->mem[i].style=s->scr[i].style=0;
-	s->mem[i].d[0]=' ';
-	s->mem[i].d[1]=0;
-	s->scr[i].d[0]=0;
+static inline void yascreen_free_memcell(yascreen *s,size_t i) { // {{{
+	yascreen_glyph_unref(s,s->mem.glyph[i]);
+	s->mem.glyph[i]=0;
 } // }}}
 
-static inline void yascreen_free_empty_cell(yascreen *s,size_t i) { // {{{
-	yascreen_free_cell(s,i);
-	yascreen_empty_cell(s,i);
+static inline void yascreen_free_pastes(paste *p) { // {{{
+	while (p) {
+		paste *n=p->next;
+
+		free(p->data);
+		free(p);
+		p=n;
+	}
 } // }}}
 
 static inline void yascreen_free_dynamic(yascreen *s) { // {{{
-	if (s->mem)
-		free(s->mem);
-	if (s->scr)
-		free(s->scr);
+	if (s->pbuf)
+		free(s->pbuf);
+	if (s->fmtb)
+		free(s->fmtb);
+	yascreen_free_pastes(s->pastes);
+	yascreen_free_pastes(s->pastecur);
+	yascreen_cbuf_free(&s->mem);
+	yascreen_cbuf_free(&s->scr);
+	if (s->touched)
+		free(s->touched);
+	if (s->scrolls)
+		free(s->scrolls);
+	if (s->clu) {
+		uint32_t i;
+
+		for (i=1;i<s->clucnt;i++)
+			if (s->clu[i].ref)
+				free(s->clu[i].str);
+		free(s->clu);
+	}
+	if (s->cluhash)
+		free(s->cluhash);
 	if (s->tsstack)
 		free(s->tsstack);
 	if (s->keys)
 		free(s->keys);
+	if (s->keyts)
+		free(s->keyts);
+	if (s->keyp)
+		free(s->keyp);
+	if (s->mice)
+		free(s->mice);
 } // }}}
 
 inline yascreen *yascreen_init(int sx,int sy) { // {{{
 	yascreen *s;
-	size_t i;
 
 	yascreen_ver_init();
 
@@ -483,16 +977,45 @@ inline yascreen *yascreen_init(int sx,int sy) { // {{{
 	// s->outcb is already NULL
 	// s->mem is initialized below
 	// s->scr is initialized below
+	// s->pitch is initialized below
+	// s->nslot is initialized below
+	// s->touched is initialized below
+	// s->scrolls is already NULL
+	// s->scrollsize is already zero
+	// s->scrollcnt is already zero
+	// s->clu is already zero
+	// s->clusize is already zero
+	// s->clucnt is already zero
+	// s->clulive is already zero
+	// s->clufree is already zero
+	// s->cluhash is already zero
+	// s->cluhsize is already zero
 	// s->tstack is initialized above
 	// s->tssize is initialized above
 	s->escto=YAS_DEFAULT_ESCTO;
 	// s->keysize is initialized below
 	// s->keycnt is already zero
 	// s->keys is initialized below
+	// s->keyts is initialized below
+	// s->keyp is initialized below
+	// s->pbuf is already NULL
+	// s->plen is already zero
+	// s->psize is already zero
+	// s->pastes is already NULL
+	// s->pastel is already NULL
+	// s->pastecur is already NULL
+	// s->micesize is already zero
+	// s->micecnt is already zero
+	// s->mice is already NULL
+	// s->mousecur is already zeroes
 	// s->ansibuf is already zeroes
 	// s->ansipos is already zero
 	// s->sosnbuf is already zeroes
 	// s->sosnpos is already zero
+	// s->pendpos is already zero
+	// s->plost is already zero
+	// s->havemouse is already zero
+	// s->havepaste is already zero
 	// s->utf is already zeroes
 	// s->escts is already zero
 	s->state=ST_NORM;
@@ -505,6 +1028,16 @@ inline yascreen *yascreen_init(int sx,int sy) { // {{{
 	// s->haveansi is already zero
 	// s->havenaws is already zero
 	// s->istelnet is already zero
+	// s->kbd is already zero
+	// s->ispaste is already zero
+	// s->mouse is already zero
+	// s->caps is already zero
+	// s->ambiwide is already zero
+	// s->winch is already zero
+	// s->winchpend is already zero
+	// s->winchgen is already zero
+	// s->winchts is already zero
+	// s->storage is already zero
 	s->isunicode=1; // previous versions were unicode only
 	s->cursor=1; // cursor is visible by default
 	s->redraw=1; // leave scr empty, so that on first refresh everything is redrawn
@@ -513,24 +1046,32 @@ inline yascreen *yascreen_init(int sx,int sy) { // {{{
 	// s->phint is already NULL
 	// s->outb is already zeroes
 	// s->outp is already zero
+	// s->clearpend is already zero
+	// s->clearattr is already zero
+	// s->fmtb is already NULL
+	// s->fmtsize is already zero
 
 	s->keys=(int *)calloc(KEYSTEP,sizeof(int));
-	if (!s->keys) {
+	s->keyts=(int64_t *)calloc(KEYSTEP,sizeof(int64_t));
+	s->keyp=(uint8_t *)calloc(KEYSTEP,sizeof(uint8_t));
+	if (!s->keys||!s->keyts||!s->keyp) {
 		yascreen_free_dynamic(s);
 		free(s);
 		return NULL;
 	}
 	s->keysize=KEYSTEP;
-	s->mem=(cell *)calloc((size_t)sx*sy,sizeof(cell));
-	s->scr=(cell *)calloc((size_t)sx*sy,sizeof(cell));
-	if (!s->mem||!s->scr) {
+	s->pitch=sx;
+	s->nslot=(uint32_t)sy+1;
+	if ((size_t)s->pitch>SIZE_MAX/sizeof(uint32_t)/s->nslot||yascreen_grow(s,s->pitch,s->nslot)) {
 		yascreen_free_dynamic(s);
 		free(s);
 		return NULL;
 	}
+	// all lines are in the blank slot, so the other slots are not touched until used
+	yascreen_cbuf_reset(s,&s->mem);
+	yascreen_cbuf_reset(s,&s->scr);
+	memset(s->touched,0,s->nslot*sizeof *s->touched);
 
-	for (i=0;i<(size_t)sx*sy;i++)
-		strncpy(s->mem[i].d," ",sizeof s->mem[i].d);
 	return s;
 } // }}}
 
@@ -550,11 +1091,22 @@ inline void yascreen_set_telnet(yascreen *s,int on) { // {{{
 	s->tstate=T_NORM; // reset the telnet state machine to avoid a stuck byte-eating state across mode changes
 } // }}}
 
+static inline void yascreen_flush_input(yascreen *s) { // {{{
+	// drop all queued input together with the mouse events and pastes that belong to it
+	s->keycnt=0;
+	s->micecnt=0;
+	yascreen_free_pastes(s->pastes);
+	s->pastes=s->pastel=NULL;
+	s->plen=0; // the paste being collected is lost too
+	if (s->state==ST_PASTE) // the rest of it is dropped when it ends, pendpos still tracks the end marker
+		s->plost=1;
+} // }}}
+
 inline void yascreen_set_unicode(yascreen *s,int on) { // {{{
 	if (!s)
 		return;
 	s->isunicode=!!on;
-	s->keycnt=0; // flush input buffer - it may not be verified unicode
+	yascreen_flush_input(s); // it may not be verified unicode
 } // }}}
 
 inline void yascreen_init_telnet(yascreen *s) { // {{{
@@ -581,10 +1133,167 @@ inline void yascreen_init_telnet(yascreen *s) { // {{{
 		,18);
 } // }}}
 
+static inline void yascreen_kbd_out(yascreen *s,int mode) { // {{{
+	if ((s->kbd^mode)&YAS_KBD_CSIU)
+		outs(s,(mode&YAS_KBD_CSIU)?ESC"[>5u":ESC"[<u"); // push disambiguate and report alternate keys flags or pop them back
+	if ((s->kbd^mode)&YAS_KBD_MOK)
+		outs(s,(mode&YAS_KBD_MOK)?ESC"[>4;2m":ESC"[>4m"); // set modifyOtherKeys to level 2 or reset it
+	s->kbd=mode;
+} // }}}
+
+inline void yascreen_set_kbd(yascreen *s,int mode) { // {{{
+	if (!s)
+		return;
+
+	yascreen_kbd_out(s,mode&(YAS_KBD_MOK|YAS_KBD_CSIU));
+	if (s->lineflush)
+		outs(s,""); // request a flush
+} // }}}
+
+inline void yascreen_set_ambiwide(yascreen *s,int on) { // {{{
+	if (!s)
+		return;
+
+	s->ambiwide=!!on;
+} // }}}
+
+inline void yascreen_set_caps(yascreen *s,int caps) { // {{{
+	if (!s)
+		return;
+
+	s->caps=caps&(YAS_CAP_LRMM|YAS_CAP_BCE|YAS_CAP_SUSD);
+} // }}}
+
+inline void yascreen_set_paste(yascreen *s,int on) { // {{{
+	if (!s)
+		return;
+
+	s->ispaste=!!on;
+	if (on)
+		outs(s,ESC"[?2004h"); // enable bracketed paste
+	else
+		outs(s,ESC"[?2004l"); // disable bracketed paste
+	if (s->lineflush)
+		outs(s,""); // request a flush
+} // }}}
+
+static inline paste *yascreen_pop_paste(yascreen *s) { // {{{
+	// move the oldest paste to the list of pastes returned to the application
+	paste *p=s->pastes;
+
+	if (!p)
+		return NULL;
+	s->pastes=p->next;
+	if (!s->pastes)
+		s->pastel=NULL;
+	p->next=s->pastecur;
+	s->pastecur=p;
+	return p;
+} // }}}
+
+inline const char *yascreen_getpaste(yascreen *s,size_t *len) { // {{{
+	paste *p;
+
+	if (len)
+		*len=0;
+	if (!s)
+		return NULL;
+
+	if (!s->havepaste) // there is no retrieved YAS_PASTE or its data is already returned
+		return NULL;
+	s->havepaste=0;
+	p=s->pastecur;
+	if (len)
+		*len=p->len;
+	return p->data?p->data:"";
+} // }}}
+
+inline void yascreen_set_mouse(yascreen *s,int mode) { // {{{
+	if (!s)
+		return;
+
+	switch (mode) {
+		case YAS_MOUSE_OFF:
+			outs(s,ESC"[?1003l"ESC"[?1002l"ESC"[?1000l"ESC"[?1006l");
+			break;
+		case YAS_MOUSE_CLICK:
+			outs(s,ESC"[?1003l"ESC"[?1002l"ESC"[?1000h"ESC"[?1006h"); // sgr encoding is not limited to 223 columns
+			break;
+		case YAS_MOUSE_DRAG:
+			outs(s,ESC"[?1003l"ESC"[?1002h"ESC"[?1006h");
+			break;
+		case YAS_MOUSE_MOTION:
+			outs(s,ESC"[?1003h"ESC"[?1006h");
+			break;
+		default: // unknown mode, keep the current one
+			return;
+	}
+	s->mouse=mode;
+	if (s->lineflush)
+		outs(s,""); // request a flush
+} // }}}
+
+inline int yascreen_getmouse(yascreen *s,yas_mouse *m) { // {{{
+	if (!s)
+		return -1;
+	if (!s->havemouse) // there is no retrieved YAS_MOUSE or its event is already returned
+		return -1;
+
+	if (m)
+		*m=s->mousecur;
+	s->havemouse=0;
+	return 0;
+} // }}}
+
+inline int yascreen_set_winch(yascreen *s,int on) { // {{{
+	if (!s)
+		return -1;
+
+	on=!!on;
+	if (s->winch==on)
+		return 0;
+	if (on) {
+		if (s->outcb||!isatty(STDOUT_FILENO)) // there is no SIGWINCH for other outputs
+			return -1;
+		if (!winchusers) {
+			struct sigaction sa;
+			int i;
+
+			if (pipe(winchpipe))
+				return -1;
+			for (i=0;i<2;i++) {
+				fcntl(winchpipe[i],F_SETFL,fcntl(winchpipe[i],F_GETFL)|O_NONBLOCK);
+				fcntl(winchpipe[i],F_SETFD,FD_CLOEXEC);
+			}
+			memset(&sa,0,sizeof sa);
+			sa.sa_sigaction=yascreen_winch_handler;
+			sigemptyset(&sa.sa_mask);
+			sa.sa_flags=SA_RESTART|SA_SIGINFO;
+			if (sigaction(SIGWINCH,&sa,&winchold)) {
+				close(winchpipe[0]);
+				close(winchpipe[1]);
+				winchpipe[0]=winchpipe[1]=-1;
+				return -1;
+			}
+		}
+		winchusers++;
+		s->winchgen=winchcnt;
+	} else {
+		if (!--winchusers) { // last user restores the previous action
+			sigaction(SIGWINCH,&winchold,NULL);
+			close(winchpipe[0]);
+			close(winchpipe[1]);
+			winchpipe[0]=winchpipe[1]=-1;
+		}
+	}
+	s->winch=on;
+	s->winchpend=0;
+	return 0;
+} // }}}
+
 inline int yascreen_resize(yascreen *s,int sx,int sy) { // {{{
-	cell *mem,*scr;
-	size_t i;
-	int grow;
+	uint32_t nslot;
+	int y,pitch;
 
 	if (!s)
 		return -1;
@@ -600,49 +1309,146 @@ inline int yascreen_resize(yascreen *s,int sx,int sy) { // {{{
 	if (s->sx==sx&&s->sy==sy)
 		return 0;
 
-	if ((size_t)sx>SIZE_MAX/sizeof(cell)/(size_t)sy) // requested size overflows
+	pitch=mymax(sx,s->pitch); // the existing allocation is reused
+	nslot=mymax((uint32_t)sy+1,s->nslot);
+	if ((size_t)pitch>SIZE_MAX/sizeof(uint32_t)/nslot) // requested size overflows
 		return -1;
 
-	grow=(size_t)sx*sy>(size_t)s->sx*s->sy;
-	if (grow) { // allocate bigger buffers first, so that a failure leaves the screen intact
-		mem=(cell *)realloc(s->mem,(size_t)sx*sy*sizeof(cell));
-		if (!mem)
-			return -1;
-		s->mem=mem;
-		scr=(cell *)realloc(s->scr,(size_t)sx*sy*sizeof(cell));
-		if (!scr)
+	if (pitch!=s->pitch||nslot!=s->nslot) // allocate bigger buffers first, so that a failure leaves the screen intact
+		if (yascreen_grow(s,pitch,nslot))
 			return -1;
-		s->scr=scr;
-	}
-	for (i=0;i<(size_t)s->sx*s->sy;i++) // free old allocated data and set for reusage
-		if (i<(size_t)sx*sy)
-			yascreen_free_empty_cell(s,i);
-		else
-			yascreen_free_cell(s,i);
-	if (grow)
-		for (i=(size_t)s->sx*s->sy;i<(size_t)sx*sy;i++) // initialize the rest of the area
-			yascreen_empty_cell(s,i);
+	for (y=0;y<s->sy;y++) { // free old allocated data
+		yascreen_blank_row(s,&s->mem,y);
+		yascreen_blank_row(s,&s->scr,y);
+	}
 	s->redraw=1;
+	s->scrollcnt=0; // the screen is repainted anyway
 	s->sx=sx;
 	s->sy=sy;
+	s->pitch=pitch;
+	s->nslot=nslot;
+	yascreen_cbuf_reset(s,&s->mem);
+	yascreen_cbuf_reset(s,&s->scr);
+	memset(s->touched,0,s->nslot*sizeof *s->touched);
 
 	return 0;
 } // }}}
 
-inline void yascreen_free(yascreen *s) { // {{{
-	size_t i;
+inline int yascreen_resize_keep(yascreen *s,int sx,int sy) { // {{{
+	size_t o;
+	uint32_t sl,nslot;
+	int x,y,osx,osy,cx,cy,pitch,opitch;
+
+	if (!s)
+		return -1;
+
+	if (sx<0||sy<0)
+		return -1;
+
+	yascreen_auto_size(s,&sx,&sy);
+
+	if (sx<=0||sy<=0)
+		return -1;
+
+	if (s->sx==sx&&s->sy==sy)
+		return 0;
+
+	osx=s->sx;
+	osy=s->sy;
+	opitch=s->pitch;
+	cx=mymin(sx,osx); // the kept rectangle
+	cy=mymin(sy,osy);
+	pitch=mymax(sx,opitch); // a narrower screen keeps the lines in place
+	nslot=mymax((uint32_t)sy+1,s->nslot);
+	if ((size_t)pitch>SIZE_MAX/sizeof(uint32_t)/nslot) // requested size overflows
+		return -1;
+
+	if (pitch!=opitch||nslot!=s->nslot) // allocate bigger buffers first, so that a failure leaves the screen intact
+		if (yascreen_grow(s,pitch,nslot))
+			return -1;
+	if (cx<osx) // a wide character cut in half by the right edge becomes a space
+		for (y=0;y<cy;y++)
+			if (yascreen_is_wtail(s,yascreen_roff(s,&s->mem,y)+cx)) {
+				yascreen_free_memcell(s,yascreen_roff(s,&s->mem,y)+cx-1); // keeps the style
+				o=yascreen_woff(s,&s->scr,y)+cx-1;
+				yascreen_glyph_unref(s,s->scr.glyph[o]);
+				s->scr.glyph[o]=0;
+				s->scr.style[o]=YAS_WTAIL; // does not match a blank, so it is repainted
+				s->touched[y]=1;
+			}
+	for (y=0;y<osy;y++) // free the data that is cut off
+		if (y>=cy) {
+			yascreen_blank_row(s,&s->mem,y);
+			yascreen_blank_row(s,&s->scr,y);
+		} else if (cx<osx) {
+			if (s->mem.row[y])
+				yascreen_free_cells(s,&s->mem,yascreen_roff(s,&s->mem,y)+cx,osx-cx);
+			if (s->scr.row[y])
+				yascreen_free_cells(s,&s->scr,yascreen_roff(s,&s->scr,y)+cx,osx-cx);
+		}
+	if (pitch>opitch) { // slots move forward, go backwards to not overwrite them
+		for (sl=s->nslot-1;sl>0;sl--) {
+			memmove(s->mem.style+(size_t)sl*pitch,s->mem.style+(size_t)sl*opitch,cx*sizeof *s->mem.style);
+			memmove(s->mem.glyph+(size_t)sl*pitch,s->mem.glyph+(size_t)sl*opitch,cx*sizeof *s->mem.glyph);
+			memmove(s->scr.style+(size_t)sl*pitch,s->scr.style+(size_t)sl*opitch,cx*sizeof *s->scr.style);
+			memmove(s->scr.glyph+(size_t)sl*pitch,s->scr.glyph+(size_t)sl*opitch,cx*sizeof *s->scr.glyph);
+		}
+		s->pitch=pitch;
+	}
+	for (sl=nslot-1;sl>=s->nslot;sl--) { // new slots are unused
+		s->mem.freeslot[s->mem.nfree++]=sl;
+		s->scr.freeslot[s->scr.nfree++]=sl;
+	}
+	s->nslot=nslot;
+	s->sx=sx;
+	s->sy=sy;
+	memset(s->mem.style,0,sx*sizeof *s->mem.style); // the blank slot may have been overwritten by a move
+	memset(s->mem.glyph,0,sx*sizeof *s->mem.glyph);
+	memset(s->scr.style,0,sx*sizeof *s->scr.style);
+	memset(s->scr.glyph,0,sx*sizeof *s->scr.glyph);
+	for (y=0;y<sy;y++) { // newly exposed cells are repainted
+		if (y<cy&&cx==sx)
+			continue;
+		if (y>=cy) {
+			s->mem.row[y]=0;
+			s->scr.row[y]=0;
+		} else if (s->mem.row[y]) { // cells past the old width hold nothing, but are not initialized
+			memset(s->mem.style+yascreen_roff(s,&s->mem,y)+cx,0,(sx-cx)*sizeof *s->mem.style);
+			memset(s->mem.glyph+yascreen_roff(s,&s->mem,y)+cx,0,(sx-cx)*sizeof *s->mem.glyph);
+		}
+		o=yascreen_woff(s,&s->scr,y);
+		for (x=(y<cy)?cx:0;x<sx;x++) {
+			s->scr.style[o+x]=YAS_WTAIL; // does not match a blank, so it is repainted
+			s->scr.glyph[o+x]=0;
+		}
+		s->touched[y]=1;
+	}
+	if (s->scrollcnt) { // queued scrolls do not fit the new size, repaint instead
+		s->redraw=1;
+		s->scrollcnt=0;
+	}
+	s->cursorx=mymin(s->cursorx,sx-1);
+	s->cursory=mymin(s->cursory,sy-1);
+
+	return 0;
+} // }}}
 
+inline void yascreen_free(yascreen *s) { // {{{
 	if (!s)
 		return;
 
-	if (!s->mem||!s->scr) { // error condition that will happen only if mem is corrupt
+	if (!s->mem.style||!s->mem.glyph||!s->scr.style||!s->scr.glyph) { // error condition that will happen only if mem is corrupt
 		yascreen_free_dynamic(s);
 		free(s); // most probably will crash, because there is no way to have s partally initialized
 		return;
 	}
-	for (i=0;i<(size_t)s->sx*s->sy;i++)
-		yascreen_free_cell(s,i);
+	yascreen_set_winch(s,0);
 	yascreen_free_dynamic(s);
+	yascreen_kbd_out(s,0); // do not leave the terminal with extended keyboard protocols
+	if (s->ispaste)
+		outs(s,ESC"[?2004l");
+	if (s->mouse)
+		outs(s,ESC"[?1003l"ESC"[?1002l"ESC"[?1000l"ESC"[?1006l");
 	outs(s,ESC"[0m");
 	outs(s,""); // flush the attribute reset before the state is gone
 	free(s);
@@ -691,42 +1497,368 @@ inline void yascreen_update_attr(yascreen *s,uint32_t oattr,uint32_t nattr) { //
 	}
 } // }}}
 
-static inline int yascreen_update_range(yascreen *s,int y1,int y2) { // {{{
-	int i,j,ob=0,redraw=0;
-	char ra[]=ESC"[0m";
-	uint32_t lsty=0,nsty;
+// {{{ row comparison
 
-	if (!s)
-		return -1;
+// find the first and the last differing byte of two pairs of memory blocks (a1 vs b1 and a2 vs b2) of the same length
+// returns 0 if both pairs are the same; the bounds are only candidates for a cell based comparison, the caller confirms them
 
-	y1=mymin(s->sy-1,mymax(0,y1));
-	y2=mymin(s->sy,mymax(0,y2));
+#if !YAS_X86_SIMD
+static int yascreen_diff_gen(const void *a1,const void *b1,const void *a2,const void *b2,size_t len,size_t *first,size_t *last) { // {{{
+	const unsigned char *p1=a1,*q1=b1,*p2=a2,*q2=b2;
+	size_t lo=0,hi=len;
 
-	if (s->redraw&&y1==0&&y2==s->sy) { // a full redraw is honored only for a full range update; partial updates keep it pending
-		redraw=1;
-		s->redraw=0;
-		if (outf(s,ESC"[2J"ESC"[H%s",ra)<0) // clear and position on topleft
-			ob=-1;
-		*ra=0;
+	while (lo+sizeof(uint64_t)<=len) {
+		uint64_t x1,y1,x2,y2;
+
+		memcpy(&x1,p1+lo,sizeof x1);
+		memcpy(&y1,q1+lo,sizeof y1);
+		memcpy(&x2,p2+lo,sizeof x2);
+		memcpy(&y2,q2+lo,sizeof y2);
+		if (x1!=y1||x2!=y2)
+			break;
+		lo+=sizeof x1;
 	}
+	while (lo<len&&p1[lo]==q1[lo]&&p2[lo]==q2[lo])
+		lo++;
+	if (lo==len)
+		return 0;
+	while (hi>lo+sizeof(uint64_t)) {
+		uint64_t x1,y1,x2,y2;
+
+		memcpy(&x1,p1+hi-sizeof x1,sizeof x1);
+		memcpy(&y1,q1+hi-sizeof y1,sizeof y1);
+		memcpy(&x2,p2+hi-sizeof x2,sizeof x2);
+		memcpy(&y2,q2+hi-sizeof y2,sizeof y2);
+		if (x1!=y1||x2!=y2)
+			break;
+		hi-=sizeof x1;
+	}
+	while (p1[hi-1]==q1[hi-1]&&p2[hi-1]==q2[hi-1])
+		hi--;
+	*first=lo;
+	*last=hi-1;
+	return 1;
+} // }}}
+#endif
 
-	for (j=y1;j<y2;j++) {
-		int skip=1,cnt=0;
+#if YAS_X86_SIMD
+static inline unsigned yascreen_neq_sse2(const unsigned char *p1,const unsigned char *q1,const unsigned char *p2,const unsigned char *q2) { // {{{
+	// mask of the differing bytes in 16 bytes
+	__m128i e1=_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *)p1),_mm_loadu_si128((const __m128i *)q1));
+	__m128i e2=_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *)p2),_mm_loadu_si128((const __m128i *)q2));
 
-		if (!redraw&&!(s->mem[(size_t)s->sx*j].style&YAS_TOUCHED)) // skip untouched lines
-			continue;
-		s->mem[(size_t)s->sx*j].style&=~YAS_TOUCHED; // mark updated lines as not touched
-		for (i=0;i<s->sx;i++) {
-			int diff=redraw; // forced redraw
+	return 0xffff&~(unsigned)_mm_movemask_epi8(_mm_and_si128(e1,e2));
+} // }}}
 
-			if (!diff) // compare attributes
-				diff=(s->mem[i+(size_t)s->sx*j].style&~YAS_INTERNAL)!=(s->scr[i+(size_t)s->sx*j].style&~YAS_INTERNAL);
-			if (!diff) // compare content
-				diff=!!strcmp((s->mem[i+(size_t)s->sx*j].style&YAS_STORAGE)?s->mem[i+(size_t)s->sx*j].p:s->mem[i+(size_t)s->sx*j].d,(s->scr[i+(size_t)s->sx*j].style&YAS_STORAGE)?s->scr[i+(size_t)s->sx*j].p:s->scr[i+(size_t)s->sx*j].d);
+static int yascreen_diff_sse2(const void *a1,const void *b1,const void *a2,const void *b2,size_t len,size_t *first,size_t *last) { // {{{
+	const unsigned char *p1=a1,*q1=b1,*p2=a2,*q2=b2;
+	size_t lo=0,hi=len;
+	unsigned m=0;
 
-			if (diff||!skip) {
-				if (skip) {
-					if (outf(s,ESC"[%d;%dH%s",1+j,1+i,ra)<0)
+	for (;lo+16<=len;lo+=16)
+		if ((m=yascreen_neq_sse2(p1+lo,q1+lo,p2+lo,q2+lo)))
+			break;
+	if (m)
+		lo+=__builtin_ctz(m);
+	else {
+		while (lo<len&&p1[lo]==q1[lo]&&p2[lo]==q2[lo])
+			lo++;
+		if (lo==len)
+			return 0;
+	}
+	for (m=0;hi>=lo+16;hi-=16)
+		if ((m=yascreen_neq_sse2(p1+hi-16,q1+hi-16,p2+hi-16,q2+hi-16)))
+			break;
+	if (m)
+		hi-=__builtin_clz(m)-16;
+	else
+		while (p1[hi-1]==q1[hi-1]&&p2[hi-1]==q2[hi-1])
+			hi--;
+	*first=lo;
+	*last=hi-1;
+	return 1;
+} // }}}
+
+__attribute__((target("avx2")))
+static inline uint32_t yascreen_neq_avx2(const unsigned char *p1,const unsigned char *q1,const unsigned char *p2,const unsigned char *q2) { // {{{
+	// mask of the differing bytes in 32 bytes
+	__m256i e1=_mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i *)p1),_mm256_loadu_si256((const __m256i *)q1));
+	__m256i e2=_mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i *)p2),_mm256_loadu_si256((const __m256i *)q2));
+
+	return ~(uint32_t)_mm256_movemask_epi8(_mm256_and_si256(e1,e2));
+} // }}}
+
+__attribute__((target("avx2")))
+static int yascreen_diff_avx2(const void *a1,const void *b1,const void *a2,const void *b2,size_t len,size_t *first,size_t *last) { // {{{
+	const unsigned char *p1=a1,*q1=b1,*p2=a2,*q2=b2;
+	size_t lo=0,hi=len;
+	uint32_t m=0;
+
+	for (;lo+32<=len;lo+=32)
+		if ((m=yascreen_neq_avx2(p1+lo,q1+lo,p2+lo,q2+lo)))
+			break;
+	if (m)
+		lo+=__builtin_ctz(m);
+	else {
+		while (lo<len&&p1[lo]==q1[lo]&&p2[lo]==q2[lo])
+			lo++;
+		if (lo==len)
+			return 0;
+	}
+	for (m=0;hi>=lo+32;hi-=32)
+		if ((m=yascreen_neq_avx2(p1+hi-32,q1+hi-32,p2+hi-32,q2+hi-32)))
+			break;
+	if (m)
+		hi-=__builtin_clz(m);
+	else
+		while (p1[hi-1]==q1[hi-1]&&p2[hi-1]==q2[hi-1])
+			hi--;
+	*first=lo;
+	*last=hi-1;
+	return 1;
+} // }}}
+#endif
+
+static int yascreen_diff_init(const void *a1,const void *b1,const void *a2,const void *b2,size_t len,size_t *first,size_t *last);
+
+// selected on first use according to the cpu features
+static int (*yascreen_diff)(const void *a1,const void *b1,const void *a2,const void *b2,size_t len,size_t *first,size_t *last)=yascreen_diff_init;
+
+static int yascreen_diff_init(const void *a1,const void *b1,const void *a2,const void *b2,size_t len,size_t *first,size_t *last) { // {{{
+	#if YAS_X86_SIMD
+	__builtin_cpu_init();
+	if (YASCREEN_DIFF!=2&&__builtin_cpu_supports("avx2"))
+		yascreen_diff=yascreen_diff_avx2;
+	else
+		yascreen_diff=yascreen_diff_sse2;
+	#else
+	yascreen_diff=yascreen_diff_gen;
+	#endif
+	return yascreen_diff(a1,b1,a2,b2,len,first,last);
+} // }}}
+
+static inline int yascreen_row_diff(yascreen *s,size_t mo,size_t so,int *x1,int *x2) { // {{{
+	// find the range of cells in a row that differ between mem at mo and scr at so; cells outside of it are the same in both
+	// styles and glyphs have the same size, so they are compared in a single pass
+	size_t first,last;
+
+	if (!yascreen_diff(s->mem.style+mo,s->scr.style+so,s->mem.glyph+mo,s->scr.glyph+so,s->sx*sizeof(uint32_t),&first,&last))
+		return 0;
+	*x1=first/sizeof(uint32_t);
+	*x2=last/sizeof(uint32_t)+1;
+	return 1;
+} // }}}
+
+static inline int yascreen_row_next(yascreen *s,size_t mo,size_t so,int x1,int x2) { // {{{
+	// find the next cell in [x1,x2) that differs between mem at mo and scr at so; returns x2 if there is none
+	size_t first,last;
+
+	mo+=x1;
+	so+=x1;
+	if (!yascreen_diff(s->mem.style+mo,s->scr.style+so,s->mem.glyph+mo,s->scr.glyph+so,(size_t)(x2-x1)*sizeof(uint32_t),&first,&last))
+		return x2;
+	return x1+first/sizeof(uint32_t);
+} // }}}
+
+// }}}
+
+static inline void yascreen_cbuf_clear(yascreen *s,cbuf *b,uint32_t attr) { // {{{
+	// fill all lines with blanks in attr
+	size_t o;
+	int x,y;
+
+	for (y=0;y<s->sy;y++) {
+		if (attr) {
+			o=yascreen_woff(s,b,y);
+			yascreen_free_cells(s,b,o,s->sx);
+			for (x=0;x<s->sx;x++)
+				b->style[o+x]=attr;
+		} else // blank lines share the blank slot
+			yascreen_blank_row(s,b,y);
+	}
+} // }}}
+
+static inline int yascreen_erase_ok(yascreen *s,uint32_t attr) { // {{{
+	// blanks in attr look the same when the terminal erases them with attr set
+	if (attr&(YAS_UNDERL|YAS_STRIKE|YAS_INVERSE|YAS_INTERNAL)) // visible on blanks, but not done by the terminal on erase
+		return 0;
+	if (YAS_BG(attr)&&!(s->caps&YAS_CAP_BCE)) // the terminal would erase with the default background
+		return 0;
+	return 1;
+} // }}}
+
+static inline int yascreen_erase_run(yascreen *s,size_t mo,int x) { // {{{
+	// length of the run of blanks at x of the line at mo in mem, if it is cheaper to erase than to print; 0 otherwise
+	uint32_t attr=s->mem.style[mo+x];
+	int e;
+
+	if (s->mem.glyph[mo+x]||!yascreen_erase_ok(s,attr))
+		return 0;
+	for (e=x+1;e<s->sx&&!s->mem.glyph[mo+e]&&s->mem.style[mo+e]==attr;e++)
+		;
+	if (e-x>=(e==s->sx?YAS_EL_MIN:YAS_ECH_MIN))
+		return e-x;
+	return 0;
+} // }}}
+
+static inline int yascreen_clear_cheaper(yascreen *s) { // {{{
+	// erasing the terminal with attr as it is in s->clearattr is the same as clearing scr with it
+	// that is cheaper when fewer cells differ between mem and a clear screen than between mem and scr
+	uint32_t attr=s->clearattr;
+	size_t mo,so,ned=0,ndiff=0;
+	int x,y;
+
+	if (!yascreen_erase_ok(s,attr))
+		return 0;
+
+	for (y=0;y<s->sy;y++) {
+		if (!s->mem.row[y]&&!s->scr.row[y]) // both are in the blank slot
+			continue;
+		mo=yascreen_roff(s,&s->mem,y);
+		so=yascreen_roff(s,&s->scr,y);
+		for (x=0;x<s->sx;x++) {
+			if (s->mem.glyph[mo+x]||s->mem.style[mo+x]!=attr)
+				ned++;
+			if (s->mem.glyph[mo+x]!=s->scr.glyph[so+x]||s->mem.style[mo+x]!=s->scr.style[so+x])
+				ndiff++;
+		}
+	}
+	return ned+(size_t)s->sy<ndiff; // a line may need a cursor move more
+} // }}}
+
+static inline int yascreen_scroll_out(yascreen *s) { // {{{
+	// scroll the terminal as queued; attributes are reset first, so that new lines are blank
+	int i,j,lr=0,rv=0;
+
+	outs(s,ESC"[0m");
+	for (i=0;i<s->scrollcnt;i++) {
+		yas_scroll *q=&s->scrolls[i];
+
+		if (!lr&&(q->x1||q->x2!=s->sx-1)) { // enable left and right margins
+			outs(s,ESC"[?69h");
+			lr=1;
+		}
+		if (lr&&outf(s,ESC"[%d;%ds",q->x1+1,q->x2+1)<0)
+			rv=-1;
+		if (outf(s,ESC"[%d;%dr",q->y1+1,q->y2+1)<0)
+			rv=-1;
+		if (s->caps&YAS_CAP_SUSD) {
+			if (outf(s,ESC"[%d%c",abs(q->n),(q->n>0)?'S':'T')<0)
+				rv=-1;
+			continue;
+		}
+		// index at the bottom or reverse index at the top of the region, the linux console ignores SU/SD there
+		if (outf(s,ESC"[%d;%dH",(q->n>0)?q->y2+1:q->y1+1,q->x1+1)<0)
+			rv=-1;
+		for (j=0;j<abs(q->n);j++)
+			outs(s,(q->n>0)?ESC"D":ESC"M");
+	}
+	outs(s,ESC"[r"); // reset the scroll region
+	if (lr)
+		outs(s,ESC"[s"ESC"[?69l");
+	s->scrollcnt=0;
+	return rv;
+} // }}}
+
+static inline int yascreen_update_range(yascreen *s,int y1,int y2) { // {{{
+	int i,j,ob=0,redraw=0;
+	char ra[]=ESC"[0m";
+	char ub[5]; // utf8 encoded glyph
+	uint32_t lsty=0,nsty;
+
+	if (!s)
+		return -1;
+
+	y1=mymin(s->sy-1,mymax(0,y1));
+	y2=mymin(s->sy,mymax(0,y2));
+
+	if (s->redraw&&y1==0&&y2==s->sy) { // a full redraw is honored only for a full range update; partial updates keep it pending
+		redraw=1;
+		s->redraw=0;
+		if (outf(s,"%s"ESC"[2J"ESC"[H",ra)<0) // reset attributes, so that the terminal is cleared with the default ones, and position on topleft
+			ob=-1;
+		*ra=0;
+		s->scrollcnt=0; // the screen is repainted anyway
+		yascreen_cbuf_clear(s,&s->scr,0); // what is on the terminal now, so default blanks are skipped
+		for (j=0;j<s->sy;j++)
+			s->touched[j]=1;
+	}
+	if (s->clearpend&&y1==0&&y2==s->sy) { // a clear is honored only for a full range update, like a redraw
+		s->clearpend=0;
+		if (!redraw&&yascreen_clear_cheaper(s)) { // erase the terminal, then only what is written after the clear is painted
+			outs(s,ra);
+			*ra=0;
+			yascreen_update_attr(s,lsty,s->clearattr);
+			lsty=s->clearattr;
+			outs(s,ESC"[2J");
+			yascreen_cbuf_clear(s,&s->scr,s->clearattr);
+			s->scrollcnt=0; // scr is cleared anyway
+			for (j=0;j<s->sy;j++) // lines that were scrolled in after the clear may differ from it
+				s->touched[j]=1;
+		}
+	}
+	if (s->scrollcnt) { // scr is already scrolled, bring the terminal in sync first
+		if (yascreen_scroll_out(s)<0)
+			ob=-1;
+		*ra=0;
+	}
+
+	for (j=y1;j<y2;j++) {
+		int skip=1,cnt=0,x1=0,x2=s->sx;
+		size_t mo,so;
+
+		if (!s->touched[j]) // skip untouched lines
+			continue;
+		s->touched[j]=0; // mark updated lines as not touched
+		if (!s->mem.row[j]&&!s->scr.row[j]) // both are in the blank slot
+			continue;
+		mo=yascreen_roff(s,&s->mem,j);
+		if (!yascreen_row_diff(s,mo,yascreen_roff(s,&s->scr,j),&x1,&x2)) // nothing changed in this line
+			continue;
+		so=yascreen_woff(s,&s->scr,j);
+		for (i=x1;i<x2;i++) {
+			int diff,n,nx=yascreen_row_next(s,mo,so,i,x2); // jump over the cells that are the same in mem and scr
+
+			if (!skip)
+				cnt+=nx-i;
+			i=nx;
+			if (i>=x2)
+				break;
+
+			// compare attributes
+			diff=(s->mem.style[mo+i]&~YAS_INTERNAL)!=(s->scr.style[so+i]&~YAS_INTERNAL);
+			if (!diff) // compare content; clusters are shared, so same content has the same glyph
+				diff=s->mem.glyph[mo+i]!=s->scr.glyph[so+i]||((s->mem.style[mo+i]^s->scr.style[so+i])&YAS_WTAIL);
+
+			if (diff&&(n=yascreen_erase_run(s,mo,i))) { // a run of blanks is erased instead of printed
+				nsty=s->mem.style[mo+i];
+				if (skip||cnt) { // the cursor is not in place
+					if (outf(s,ESC"[%d;%dH%s",1+j,1+i,ra)<0)
+						ob=-1;
+					*ra=0;
+				}
+				if (lsty!=nsty) {
+					yascreen_update_attr(s,lsty,nsty);
+					lsty=nsty;
+				}
+				if (i+n==s->sx)
+					outs(s,ESC"[K"); // EL
+				else if (outf(s,ESC"[%dX",n)<0) // ECH, the cursor does not move
+					ob=-1;
+				for (n+=i;i<n;i++) {
+					yascreen_glyph_unref(s,s->scr.glyph[so+i]);
+					s->scr.glyph[so+i]=0;
+					s->scr.style[so+i]=nsty;
+				}
+				i--;
+				skip=1; // position again before the next output
+				cnt=0;
+				continue;
+			}
+
+			if (diff||!skip) {
+				if (skip) {
+					if (outf(s,ESC"[%d;%dH%s",1+j,1+i,ra)<0)
 						ob=-1;
 					*ra=0;
 					skip=0;
@@ -739,30 +1871,27 @@ static inline int yascreen_update_range(yascreen *s,int y1,int y2) { // {{{
 						cnt=0;
 					}
 					while (cnt>=0) {
-						nsty=s->mem[(size_t)j*s->sx+i-cnt].style&~YAS_INTERNAL;
+						nsty=s->mem.style[mo+i-cnt]&~YAS_INTERNAL;
 						if (lsty!=nsty) {
 							yascreen_update_attr(s,lsty,nsty);
 							lsty=nsty;
 						}
-						outs(s,(s->mem[(size_t)j*s->sx+i-cnt].style&YAS_STORAGE)?s->mem[(size_t)j*s->sx+i-cnt].p:s->mem[(size_t)j*s->sx+i-cnt].d);
+						outs(s,yascreen_cell_str(s,&s->mem,mo+i-cnt,ub));
 						cnt--;
 					}
 					cnt=0; // loop above leaves cnt at -1
 				} else
 					cnt++;
 			}
-			if (s->scr[(size_t)j*s->sx+i].style&YAS_STORAGE)
-				free(s->scr[(size_t)j*s->sx+i].p);
-			s->scr[(size_t)j*s->sx+i].style=s->mem[(size_t)j*s->sx+i].style;
-			if (s->mem[(size_t)j*s->sx+i].style&YAS_STORAGE) {
-				s->scr[(size_t)j*s->sx+i].p=strdup(s->mem[(size_t)j*s->sx+i].p);
-				if (!s->scr[(size_t)j*s->sx+i].p) { // make it empty in case of allocation failure
-					s->scr[(size_t)j*s->sx+i].style&=~YAS_STORAGE;
-					strcpy(s->scr[(size_t)j*s->sx+i].d," ");
-				}
-			} else
-				strncpy(s->scr[(size_t)j*s->sx+i].d,s->mem[(size_t)j*s->sx+i].d,sizeof s->scr[(size_t)j*s->sx+i].d);
+			s->scr.style[so+i]=s->mem.style[mo+i];
+			if (s->scr.glyph[so+i]!=s->mem.glyph[mo+i]) {
+				yascreen_glyph_ref(s,s->mem.glyph[mo+i]);
+				yascreen_glyph_unref(s,s->scr.glyph[so+i]);
+				s->scr.glyph[so+i]=s->mem.glyph[mo+i];
+			}
 		}
+		if (!s->mem.row[j]) // scr is blank too, share the blank slot
+			yascreen_blank_row(s,&s->scr,j);
 	}
 	if (s->cursor)
 		if (outf(s,ESC"[%d;%dH",s->cursory+1,s->cursorx+1)<0)
@@ -780,9 +1909,34 @@ inline int yascreen_update(yascreen *s) { // {{{
 	return yascreen_update_range(s,0,s->sy);
 } // }}}
 
-static inline int yascreen_is_wtail(yascreen *s,size_t pos) { // {{{
-	// tail cells of wide characters hold empty content
-	return !(s->mem[pos].style&YAS_STORAGE)&&!s->mem[pos].d[0];
+static inline void yascreen_wide_cut(yascreen *s,size_t o,int x1,int x2) { // {{{
+	// cells [x1,x2) of the line at o are going to be overwritten; blank the rest of wide chars that are partially in the range
+	int x;
+
+	if (x1>0&&yascreen_is_wtail(s,x1+o)) { // overwriting the tail of a wide char - blank the cells of the wide char before it
+		for (x=x1-1;x>0&&yascreen_is_wtail(s,x+o);x--)
+			;
+		for (;x<x1;x++) {
+			yascreen_free_memcell(s,x+o); // leaves a blank
+			s->mem.style[x+o]&=~YAS_WTAIL;
+		}
+	}
+	for (x=x2;x<s->sx&&yascreen_is_wtail(s,x+o);x++) { // blank orphaned tail cells of a partially overwritten wide char
+		s->mem.glyph[x+o]=0;
+		s->mem.style[x+o]&=~YAS_WTAIL;
+	}
+} // }}}
+
+static inline int yascreen_cell_same(yascreen *s,size_t o,int x,int width,uint32_t g,uint32_t attr) { // {{{
+	// the line at o already has glyph g of width columns in attr at x, so storing it would change nothing
+	int i;
+
+	if (s->mem.glyph[o+x]!=g||s->mem.style[o+x]!=attr)
+		return 0;
+	for (i=1;i<width&&x+i<s->sx;i++)
+		if (s->mem.glyph[o+x+i]||s->mem.style[o+x+i]!=(attr|YAS_WTAIL))
+			return 0;
+	return x+width>=s->sx||!yascreen_is_wtail(s,o+x+width); // a longer wide char would be cut
 } // }}}
 
 static inline void yascreen_putcw(yascreen *s,uint32_t attr,const char *str,int width) { // {{{
@@ -805,59 +1959,53 @@ static inline void yascreen_putcw(yascreen *s,uint32_t attr,const char *str,int
 	if (s->cursory<0||s->cursory>=s->sy)
 		return;
 	if (width&&s->cursorx>=0&&s->cursorx<s->sx&&s->cursorx+width<=s->sx) {
+		size_t o=yascreen_roff(s,&s->mem,s->cursory);
+		uint32_t g;
 		int i;
 
 		// normal char
-		if (yascreen_is_wtail(s,s->cursorx+(size_t)s->cursory*s->sx)) { // overwriting the tail of a wide char - blank the cells of the wide char before it
-			int x=s->cursorx-1;
-
-			while (x>0&&yascreen_is_wtail(s,x+(size_t)s->cursory*s->sx))
-				x--;
-			for (;x<s->cursorx;x++) {
-				yascreen_free_memcell(s,x+(size_t)s->cursory*s->sx);
-				strncpy(s->mem[x+(size_t)s->cursory*s->sx].d," ",sizeof s->mem[x+(size_t)s->cursory*s->sx].d);
-				s->mem[x+(size_t)s->cursory*s->sx].style&=~YAS_STORAGE;
-			}
-		}
-		yascreen_free_memcell(s,s->cursorx+(size_t)s->cursory*s->sx);
-		if (strlen(str)<PSIZE) {
-			strncpy(s->mem[s->cursorx+(size_t)s->cursory*s->sx].d,str,sizeof s->mem[s->cursorx+(size_t)s->cursory*s->sx].d);
-			s->mem[s->cursorx+(size_t)s->cursory*s->sx].style=attr;
-		} else {
-			char *ts=strdup(str);
-
-			if (!ts)
-				return; // nothing more to do
-
-			s->mem[s->cursorx+(size_t)s->cursory*s->sx].p=ts;
-			s->mem[s->cursorx+(size_t)s->cursory*s->sx].style=YAS_STORAGE|attr;
+		g=yascreen_glyph_make(s,str);
+		if (g==YAS_GLYPH_ERR)
+			return; // nothing more to do
+		if (yascreen_cell_same(s,o,s->cursorx,width,g,attr)) { // leave the line clean
+			yascreen_glyph_unref(s,g);
+			s->cursorx+=width;
+			return;
 		}
-		s->mem[(size_t)s->cursory*s->sx].style|=YAS_TOUCHED;
+		o=yascreen_woff(s,&s->mem,s->cursory);
+		yascreen_wide_cut(s,o,s->cursorx,s->cursorx+width);
+		yascreen_free_memcell(s,s->cursorx+o);
+		s->mem.glyph[s->cursorx+o]=g;
+		s->mem.style[s->cursorx+o]=attr;
+		s->touched[s->cursory]=1;
 
 		s->cursorx++;
 		for (i=1;i<width;i++) {
 			if (s->cursorx<s->sx) {
-				yascreen_free_memcell(s,s->cursorx+(size_t)s->cursory*s->sx);
-				*s->mem[s->cursorx+(size_t)s->cursory*s->sx].d=0;
-				s->mem[s->cursorx+(size_t)s->cursory*s->sx].style=attr;
+				yascreen_free_memcell(s,s->cursorx+o);
+				s->mem.style[s->cursorx+o]=attr|YAS_WTAIL;
 			}
 			s->cursorx++;
 		}
-		for (i=s->cursorx;i>=0&&i<s->sx;i++) { // blank orphaned tail cells of a partially overwritten wide char
-			if (!yascreen_is_wtail(s,i+(size_t)s->cursory*s->sx))
-				break;
-			strncpy(s->mem[i+(size_t)s->cursory*s->sx].d," ",sizeof s->mem[i+(size_t)s->cursory*s->sx].d);
-		}
 		return;
 	}
 	if (s->cursorx<0&&s->cursorx+width>=0) { // wide character spanning left bound
+		size_t o=yascreen_roff(s,&s->mem,s->cursory);
 		int x;
 
+		for (x=0;x<s->cursorx+width&&yascreen_cell_same(s,o,x,1,'<',attr);x++)
+			;
+		if (x==s->cursorx+width) { // already zapped
+			s->cursorx+=width;
+			return;
+		}
+		o=yascreen_woff(s,&s->mem,s->cursory);
+		yascreen_wide_cut(s,o,0,s->cursorx+width);
 		for (x=0;x<s->cursorx+width;x++) { // zap spanned chars
-			yascreen_free_memcell(s,x+(size_t)s->cursory*s->sx);
-			strncpy(s->mem[x+(size_t)s->cursory*s->sx].d,"<",sizeof s->mem[x+(size_t)s->cursory*s->sx].d);
-			s->mem[x+(size_t)s->cursory*s->sx].style=attr;
-			s->mem[(size_t)s->cursory*s->sx].style|=YAS_TOUCHED;
+			yascreen_free_memcell(s,x+o);
+			s->mem.glyph[x+o]='<';
+			s->mem.style[x+o]=attr;
+			s->touched[s->cursory]=1;
 		}
 		s->cursorx+=width;
 		return;
@@ -869,43 +2017,57 @@ static inline void yascreen_putcw(yascreen *s,uint32_t attr,const char *str,int
 	if (!width&&s->cursorx==0) // nowhere to append - noop
 		return;
 	if (!width&&s->cursorx>0&&s->cursorx<=s->sx) { // combining char, add to previous
-		int clen;
-		char *ts;
+		size_t o=yascreen_woff(s,&s->mem,s->cursory),clen,slen;
+		char ub[5],sb[64],*ts=sb;
+		const char *cs;
+		uint32_t g;
 
 		s->cursorx--;
 
-		clen=strlen((s->mem[s->cursorx+(size_t)s->cursory*s->sx].style&YAS_STORAGE)?s->mem[s->cursorx+(size_t)s->cursory*s->sx].p:s->mem[s->cursorx+(size_t)s->cursory*s->sx].d);
-		if (clen+strlen(str)<PSIZE) { // new fits, so current should fit too and don't have YAS_STORAGE
-			strncpy(s->mem[s->cursorx+(size_t)s->cursory*s->sx].d+clen,str,sizeof s->mem[s->cursorx+(size_t)s->cursory*s->sx].d-clen);
-			s->mem[s->cursorx+(size_t)s->cursory*s->sx].style=attr; // as a side effect combining chars set attr for main char
-		} else {
-			size_t tslen=clen+strlen(str)+1;
-
-			ts=malloc(tslen);
+		cs=yascreen_cell_str(s,&s->mem,s->cursorx+o,ub);
+		clen=strlen(cs);
+		slen=strlen(str);
+		if (clen+slen+1>sizeof sb) {
+			ts=malloc(clen+slen+1);
 			if (!ts) {
 				s->cursorx++;
 				return; // nothing more we could do
 			}
-			strcpy(ts,(s->mem[s->cursorx+(size_t)s->cursory*s->sx].style&YAS_STORAGE)?s->mem[s->cursorx+(size_t)s->cursory*s->sx].p:s->mem[s->cursorx+(size_t)s->cursory*s->sx].d);
-			strcat(ts,str);
-			if (s->mem[s->cursorx+(size_t)s->cursory*s->sx].style&YAS_STORAGE)
-				free(s->mem[s->cursorx+(size_t)s->cursory*s->sx].p);
-			s->mem[s->cursorx+(size_t)s->cursory*s->sx].p=ts;
-			s->mem[s->cursorx+(size_t)s->cursory*s->sx].style=attr|YAS_STORAGE;
 		}
-		s->mem[(size_t)s->cursory*s->sx].style|=YAS_TOUCHED;
+		memcpy(ts,cs,clen);
+		memcpy(ts+clen,str,slen+1);
+		g=yascreen_glyph_make(s,ts);
+		if (ts!=sb)
+			free(ts);
+		if (g==YAS_GLYPH_ERR) {
+			s->cursorx++;
+			return; // nothing more we could do
+		}
+		yascreen_free_memcell(s,s->cursorx+o);
+		s->mem.glyph[s->cursorx+o]=g;
+		s->mem.style[s->cursorx+o]=attr; // as a side effect combining chars set attr for main char
+		s->touched[s->cursory]=1;
 		s->cursorx++;
 	}
 	if (!width) // noop
 		return;
 	if (s->cursorx+width>s->sx) { // wide character spanning right bound
+		size_t o=yascreen_roff(s,&s->mem,s->cursory);
 		int x;
 
+		for (x=s->cursorx;x<s->sx&&yascreen_cell_same(s,o,x,1,'>',attr);x++)
+			;
+		if (x==s->sx) { // already zapped
+			s->cursorx+=width;
+			return;
+		}
+		o=yascreen_woff(s,&s->mem,s->cursory);
+		yascreen_wide_cut(s,o,s->cursorx,s->sx);
 		for (x=s->cursorx;x<s->sx;x++) { // zap spanned chars
-			yascreen_free_memcell(s,x+(size_t)s->cursory*s->sx);
-			strncpy(s->mem[x+(size_t)s->cursory*s->sx].d,">",sizeof s->mem[x+(size_t)s->cursory*s->sx].d);
-			s->mem[x+(size_t)s->cursory*s->sx].style=attr;
-			s->mem[(size_t)s->cursory*s->sx].style|=YAS_TOUCHED;
+			yascreen_free_memcell(s,x+o);
+			s->mem.glyph[x+o]='>';
+			s->mem.style[x+o]=attr;
+			s->touched[s->cursory]=1;
 		}
 		s->cursorx+=width;
 		return;
@@ -913,28 +2075,178 @@ static inline void yascreen_putcw(yascreen *s,uint32_t attr,const char *str,int
 	return;
 } // }}}
 
-inline int yascreen_putsxy(yascreen *s,int x,int y,uint32_t attr,const char *str) { // {{{
-	yas_u_state st=U_NORM;
-	char utf[5]; // 4 byte sequence + 1 for terminating 0
-	size_t i;
+static inline void yascreen_put_ascii(yascreen *s,uint32_t attr,const char *str,size_t len) { // {{{
+	// a run of printable ascii chars takes a cell for each char, which is stored as is
+	int64_t e=(int64_t)s->cursorx+(int64_t)len;
+	int x,x1=mymax(0,s->cursorx),x2=(int)mymin(e,(int64_t)s->sx);
 
-	if (!s)
-		return EOF;
-	if (!str)
-		return EOF;
-	if (attr&YAS_INTERNAL)
-		return EOF;
+	if (s->cursory<0||s->cursory>=s->sy) // same as yascreen_putcw, the position does not change
+		return;
+	if (x1<x2) {
+		size_t o=yascreen_roff(s,&s->mem,s->cursory);
 
-	s->cursorx=x; // set cursor position to whatever is requested
-	s->cursory=y;
+		str+=x1-s->cursorx;
+		for (x=x1;x<x2;x++,str++) // skip the unchanged head of the run
+			if (s->mem.glyph[o+x]!=(*str==' '?0u:(uint32_t)*str)||s->mem.style[o+x]!=attr)
+				break;
+		if (x<x2||(x2<s->sx&&yascreen_is_wtail(s,o+x2))) {
+			o=yascreen_woff(s,&s->mem,s->cursory);
+			yascreen_wide_cut(s,o,x,x2);
+			for (;x<x2;x++,str++) {
+				yascreen_free_memcell(s,x+o);
+				if (*str!=' ') // a space is 0
+					s->mem.glyph[x+o]=*str;
+				s->mem.style[x+o]=attr;
+			}
+			s->touched[s->cursory]=1;
+		}
+	}
+	s->cursorx=(int)mymin(e,(int64_t)s->sx); // past the right edge all positions are the same
+} // }}}
+
+static inline void yascreen_gc_fit(yas_gc *gc,size_t pos,int width,size_t n) { // {{{
+	// measure n clusters of the same width, starting at pos; if n>1 each cluster is a single byte
+	int64_t w=(int64_t)width*(int64_t)n;
 
-	if (x>=s->sx||y>=s->sy) {
-		s->cursorx=mymax(0,mymin(s->sx-1,s->cursorx)); // fixup position to be within screen
-		s->cursory=mymax(0,mymin(s->sy-1,s->cursory));
-		return 1; // somewhat successful print outside bounds
+	if (gc->full)
+		return;
+	if (gc->cut==(size_t)-1&&gc->total+w>gc->room) // first cluster that exceeds room
+		gc->cut=pos+(gc->room-gc->total)/width;
+	if (gc->total+w>gc->limit) {
+		gc->end=pos+(gc->limit-gc->total)/width;
+		gc->full=1;
+		return;
 	}
+	gc->total+=(int)w;
+} // }}}
 
-	for (i=0;i<strlen(str);i++) {
+static inline void yascreen_gc_flush(yascreen *s,yas_gc *gc,uint32_t attr) { // {{{
+	// put the collected grapheme cluster on screen
+	if (!gc->len)
+		return;
+	if (!gc->measure)
+		yascreen_putcw(s,attr,gc->str,gc->width);
+	else if (gc->len!=1||(*gc->str!='\n'&&*gc->str!='\r')) // as yascreen_putcw: CR and LF take no space, combining chars attach to the previous cell
+		yascreen_gc_fit(gc,gc->pos,mymax(0,gc->width),1);
+	gc->len=0;
+} // }}}
+
+static inline int yascreen_gc_break(yas_gc *gc,int gb) { // {{{
+	// check for a grapheme cluster boundary (unicode tr29) before a codepoint with break property gb
+	int pb=gc->last;
+
+	if (!gc->len)
+		return 1;
+	if (gb==YAS_GB_OTHER) // most common case, only GB9b applies
+		return pb!=YAS_GB_PREPEND;
+	if (pb==YAS_GB_CR||pb==YAS_GB_LF||pb==YAS_GB_CONTROL||gb==YAS_GB_CR||gb==YAS_GB_LF||gb==YAS_GB_CONTROL)
+		return 1; // GB4, GB5; CR LF are not kept together (GB3), yascreen_putcw handles them one by one
+	if (pb==YAS_GB_L&&(gb==YAS_GB_L||gb==YAS_GB_V||gb==YAS_GB_LV||gb==YAS_GB_LVT))
+		return 0; // GB6
+	if ((pb==YAS_GB_LV||pb==YAS_GB_V)&&(gb==YAS_GB_V||gb==YAS_GB_T))
+		return 0; // GB7
+	if ((pb==YAS_GB_LVT||pb==YAS_GB_T)&&gb==YAS_GB_T)
+		return 0; // GB8
+	if (gb==YAS_GB_EXTEND||gb==YAS_GB_ZWJ||gb==YAS_GB_SPACINGMARK)
+		return 0; // GB9, GB9a
+	if (pb==YAS_GB_PREPEND)
+		return 0; // GB9b
+	if (pb==YAS_GB_ZWJ&&gb==YAS_GB_EXTPICT&&gc->emoji)
+		return 0; // GB11
+	if (pb==YAS_GB_RI&&gb==YAS_GB_RI&&(gc->ri&1))
+		return 0; // GB12, GB13
+	return 1; // GB999
+} // }}}
+
+static inline void yascreen_gc_add(yascreen *s,yas_gc *gc,uint32_t attr,const char *utf,size_t n,int width,int gb) { // {{{
+	// add a codepoint of n bytes to the grapheme cluster; a complete cluster is put on screen at once
+	int pb=gc->last,brk=yascreen_gc_break(gc,gb);
+
+	if (brk)
+		yascreen_gc_flush(s,gc,attr);
+	if (gc->len+n+1>gc->size) {
+		size_t size=gc->size*2;
+		char *p;
+
+		if (gc->str==gc->sb) {
+			p=malloc(size);
+			if (p)
+				memcpy(p,gc->sb,gc->len);
+		} else
+			p=realloc(gc->str,size);
+		if (!p) // drop the codepoint
+			return;
+		gc->str=p;
+		gc->size=size;
+	}
+
+	if (brk) {
+		gc->pos=gc->at+1-n;
+		gc->width=width;
+		gc->first=gb;
+		gc->ri=0;
+		gc->emoji=0;
+	} else if (gb==YAS_GB_EXTEND||gb==YAS_GB_ZWJ) {
+		if (!strcmp(utf,"\xef\xb8\x8f")&&gc->width<2&&(gc->first==YAS_GB_EXTPICT||strchr("#*0123456789",*gc->str))) // emoji presentation selector
+			gc->width=2;
+	} else if (!(pb==YAS_GB_ZWJ&&gb==YAS_GB_EXTPICT)) // pictographs joined by zwj are shown as one
+		gc->width+=mymax(0,width);
+
+	memcpy(gc->str+gc->len,utf,n+1);
+	gc->len+=n;
+
+	gc->emoji=gb==YAS_GB_EXTPICT||(gc->emoji&&(gb==YAS_GB_EXTEND||gb==YAS_GB_ZWJ)&&pb!=YAS_GB_ZWJ);
+	gc->ri=gb==YAS_GB_RI?gc->ri+1:0;
+	gc->last=gb;
+} // }}}
+
+static inline void yascreen_gc_byte(yascreen *s,yas_gc *gc,uint32_t attr,char c) { // {{{
+	// add a byte that is not part of a multibyte sequence; invalid bytes stand alone
+	char b[2];
+
+	if (!c) // skip zero bytes
+		return;
+	b[0]=c;
+	b[1]=0;
+	yascreen_gc_add(s,gc,attr,b,1,1,(c&0x80)?YAS_GB_CONTROL:yascreen_uniprop((unsigned char)c)>>2); // assume width 1
+} // }}}
+
+static inline void yascreen_gc_cp(yascreen *s,yas_gc *gc,uint32_t attr,const char *utf,size_t n,uint32_t cp) { // {{{
+	// add a decoded codepoint
+	uint8_t p=yascreen_uniprop(cp);
+
+	yascreen_gc_add(s,gc,attr,utf,n,yascreen_pwidth(s,cp,p),p>>2);
+} // }}}
+
+static inline void yascreen_gc_str(yascreen *s,yas_gc *gc,uint32_t attr,const char *str,size_t len) { // {{{
+	// decode str into grapheme clusters, putting them on screen or measuring them
+	yas_u_state st=U_NORM;
+	char utf[5]; // 4 byte sequence + 1 for terminating 0
+	size_t i;
+
+	gc->str=gc->sb;
+	gc->len=0;
+	gc->size=sizeof gc->sb;
+
+	for (i=0;i<len&&!gc->full;i++) {
+		gc->at=i;
+		if (st==U_NORM&&str[i]>=0x20&&str[i]<0x7f&&yascreen_gc_break(gc,YAS_GB_OTHER)) { // printable ascii does not need the full machinery
+			size_t j;
+
+			for (j=i+1;j<len&&str[j]>=0x20&&str[j]<0x7f;j++)
+				;
+			if (j<len&&(str[j]&0x80)) // the last char may start a cluster with what follows
+				j--;
+			if (j>i) {
+				yascreen_gc_flush(s,gc,attr);
+				if (gc->measure)
+					yascreen_gc_fit(gc,i,1,j-i);
+				else
+					yascreen_put_ascii(s,attr,str+i,j-i);
+				i=j-1;
+				continue;
+			}
+		}
 		switch (st) {
 			case U_NORM:
 				if (str[i]&0x80) {
@@ -967,34 +2279,28 @@ inline int yascreen_putsxy(yascreen *s,int x,int y,uint32_t attr,const char *str
 						break;
 					}
 					// pass 0xff and 0xfe - violates rfc
-					utf[0]=str[i];
-					utf[1]=0;
-					yascreen_putcw(s,attr,utf,1); // assume width 1
+					yascreen_gc_byte(s,gc,attr,str[i]);
 					st=U_NORM; // in case we come from unexpected start byte
 				} else {
-					utf[0]=str[i];
-					utf[1]=0;
-					yascreen_putcw(s,attr,utf,1); // assume width 1
+					yascreen_gc_byte(s,gc,attr,str[i]);
 				}
 				break;
 			case U_L2C1:
 				if ((str[i]&0xc0)==0x80) { // continuation byte
-					wchar_t wc;
+					uint32_t wc;
 
 					utf[1]=str[i];
 					utf[2]=0;
 
 					wc=((utf[0]&0x1f)<<6)|(utf[1]&0x3f);
-					yascreen_putcw(s,attr,utf,wcwidth(wc));
+					yascreen_gc_cp(s,gc,attr,utf,2,wc);
 					st=U_NORM;
 					break;
 				}
 				if (str[i]&0x80) // start another sequence
 					goto startbyte;
 				st=U_NORM; // normal byte kills current sequence and is processed
-				utf[0]=str[i];
-				utf[1]=0;
-				yascreen_putcw(s,attr,utf,1); // assume width 1
+				yascreen_gc_byte(s,gc,attr,str[i]);
 				break;
 			case U_L3C1:
 				if ((str[i]&0xc0)==0x80) { // continuation byte
@@ -1005,28 +2311,24 @@ inline int yascreen_putsxy(yascreen *s,int x,int y,uint32_t attr,const char *str
 				if (str[i]&0x80) // start another sequence
 					goto startbyte;
 				st=U_NORM; // normal byte kills current sequence and is processed
-				utf[0]=str[i];
-				utf[1]=0;
-				yascreen_putcw(s,attr,utf,1); // assume width 1
+				yascreen_gc_byte(s,gc,attr,str[i]);
 				break;
 			case U_L3C2:
 				if ((str[i]&0xc0)==0x80) { // continuation byte
-					wchar_t wc;
+					uint32_t wc;
 
 					utf[2]=str[i];
 					utf[3]=0;
 
 					wc=((utf[0]&0x0f)<<12)|((utf[1]&0x3f)<<6)|(utf[2]&0x3f);
-					yascreen_putcw(s,attr,utf,wcwidth(wc));
+					yascreen_gc_cp(s,gc,attr,utf,3,wc);
 					st=U_NORM;
 					break;
 				}
 				if (str[i]&0x80) // start another sequence
 					goto startbyte;
 				st=U_NORM; // normal byte kills current sequence and is processed
-				utf[0]=str[i];
-				utf[1]=0;
-				yascreen_putcw(s,attr,utf,1); // assume width 1
+				yascreen_gc_byte(s,gc,attr,str[i]);
 				break;
 			case U_L4C1:
 				if ((str[i]&0xc0)==0x80) { // continuation byte
@@ -1037,9 +2339,7 @@ inline int yascreen_putsxy(yascreen *s,int x,int y,uint32_t attr,const char *str
 				if (str[i]&0x80) // start another sequence
 					goto startbyte;
 				st=U_NORM; // normal byte kills current sequence and is processed
-				utf[0]=str[i];
-				utf[1]=0;
-				yascreen_putcw(s,attr,utf,1); // assume width 1
+				yascreen_gc_byte(s,gc,attr,str[i]);
 				break;
 			case U_L4C2:
 				if ((str[i]&0xc0)==0x80) { // continuation byte
@@ -1050,28 +2350,24 @@ inline int yascreen_putsxy(yascreen *s,int x,int y,uint32_t attr,const char *str
 				if (str[i]&0x80) // start another sequence
 					goto startbyte;
 				st=U_NORM; // normal byte kills current sequence and is processed
-				utf[0]=str[i];
-				utf[1]=0;
-				yascreen_putcw(s,attr,utf,1); // assume width 1
+				yascreen_gc_byte(s,gc,attr,str[i]);
 				break;
 			case U_L4C3:
 				if ((str[i]&0xc0)==0x80) { // continuation byte
-					wchar_t wc;
+					uint32_t wc;
 
 					utf[3]=str[i];
 					utf[4]=0;
 
 					wc=((utf[0]&0x07)<<18)|((utf[1]&0x3f)<<12)|((utf[2]&0x3f)<<6)|(utf[3]&0x3f);
-					yascreen_putcw(s,attr,utf,wcwidth(wc));
+					yascreen_gc_cp(s,gc,attr,utf,4,wc);
 					st=U_NORM;
 					break;
 				}
 				if (str[i]&0x80) // start another sequence
 					goto startbyte;
 				st=U_NORM; // normal byte kills current sequence and is processed
-				utf[0]=str[i];
-				utf[1]=0;
-				yascreen_putcw(s,attr,utf,1); // assume width 1
+				yascreen_gc_byte(s,gc,attr,str[i]);
 				break;
 			case U_L5C1:
 				if ((str[i]&0xc0)==0x80) { // continuation byte
@@ -1082,9 +2378,7 @@ inline int yascreen_putsxy(yascreen *s,int x,int y,uint32_t attr,const char *str
 				if (str[i]&0x80) // start another sequence
 					goto startbyte;
 				st=U_NORM; // normal byte kills current sequence and is processed
-				utf[0]=str[i];
-				utf[1]=0;
-				yascreen_putcw(s,attr,utf,1); // assume width 1
+				yascreen_gc_byte(s,gc,attr,str[i]);
 				break;
 			case U_L5C2:
 				if ((str[i]&0xc0)==0x80) { // continuation byte
@@ -1095,9 +2389,7 @@ inline int yascreen_putsxy(yascreen *s,int x,int y,uint32_t attr,const char *str
 				if (str[i]&0x80) // start another sequence
 					goto startbyte;
 				st=U_NORM; // normal byte kills current sequence and is processed
-				utf[0]=str[i];
-				utf[1]=0;
-				yascreen_putcw(s,attr,utf,1); // assume width 1
+				yascreen_gc_byte(s,gc,attr,str[i]);
 				break;
 			case U_L5C3:
 				if ((str[i]&0xc0)==0x80) { // continuation byte
@@ -1108,9 +2400,7 @@ inline int yascreen_putsxy(yascreen *s,int x,int y,uint32_t attr,const char *str
 				if (str[i]&0x80) // start another sequence
 					goto startbyte;
 				st=U_NORM; // normal byte kills current sequence and is processed
-				utf[0]=str[i];
-				utf[1]=0;
-				yascreen_putcw(s,attr,utf,1); // assume width 1
+				yascreen_gc_byte(s,gc,attr,str[i]);
 				break;
 			case U_L5C4:
 				if ((str[i]&0xc0)==0x80) { // continuation byte
@@ -1123,9 +2413,7 @@ inline int yascreen_putsxy(yascreen *s,int x,int y,uint32_t attr,const char *str
 				if (str[i]&0x80) // start another sequence
 					goto startbyte;
 				st=U_NORM; // normal byte kills current sequence and is processed
-				utf[0]=str[i];
-				utf[1]=0;
-				yascreen_putcw(s,attr,utf,1); // assume width 1
+				yascreen_gc_byte(s,gc,attr,str[i]);
 				break;
 			case U_L6C1:
 				if ((str[i]&0xc0)==0x80) { // continuation byte
@@ -1136,9 +2424,7 @@ inline int yascreen_putsxy(yascreen *s,int x,int y,uint32_t attr,const char *str
 				if (str[i]&0x80) // start another sequence
 					goto startbyte;
 				st=U_NORM; // normal byte kills current sequence and is processed
-				utf[0]=str[i];
-				utf[1]=0;
-				yascreen_putcw(s,attr,utf,1); // assume width 1
+				yascreen_gc_byte(s,gc,attr,str[i]);
 				break;
 			case U_L6C2:
 				if ((str[i]&0xc0)==0x80) { // continuation byte
@@ -1149,9 +2435,7 @@ inline int yascreen_putsxy(yascreen *s,int x,int y,uint32_t attr,const char *str
 				if (str[i]&0x80) // start another sequence
 					goto startbyte;
 				st=U_NORM; // normal byte kills current sequence and is processed
-				utf[0]=str[i];
-				utf[1]=0;
-				yascreen_putcw(s,attr,utf,1); // assume width 1
+				yascreen_gc_byte(s,gc,attr,str[i]);
 				break;
 			case U_L6C3:
 				if ((str[i]&0xc0)==0x80) { // continuation byte
@@ -1162,9 +2446,7 @@ inline int yascreen_putsxy(yascreen *s,int x,int y,uint32_t attr,const char *str
 				if (str[i]&0x80) // start another sequence
 					goto startbyte;
 				st=U_NORM; // normal byte kills current sequence and is processed
-				utf[0]=str[i];
-				utf[1]=0;
-				yascreen_putcw(s,attr,utf,1); // assume width 1
+				yascreen_gc_byte(s,gc,attr,str[i]);
 				break;
 			case U_L6C4:
 				if ((str[i]&0xc0)==0x80) { // continuation byte
@@ -1175,9 +2457,7 @@ inline int yascreen_putsxy(yascreen *s,int x,int y,uint32_t attr,const char *str
 				if (str[i]&0x80) // start another sequence
 					goto startbyte;
 				st=U_NORM; // normal byte kills current sequence and is processed
-				utf[0]=str[i];
-				utf[1]=0;
-				yascreen_putcw(s,attr,utf,1); // assume width 1
+				yascreen_gc_byte(s,gc,attr,str[i]);
 				break;
 			case U_L6C5:
 				if ((str[i]&0xc0)==0x80) { // continuation byte
@@ -1190,17 +2470,282 @@ inline int yascreen_putsxy(yascreen *s,int x,int y,uint32_t attr,const char *str
 				if (str[i]&0x80) // start another sequence
 					goto startbyte;
 				st=U_NORM; // normal byte kills current sequence and is processed
-				utf[0]=str[i];
-				utf[1]=0;
-				yascreen_putcw(s,attr,utf,1); // assume width 1
+				yascreen_gc_byte(s,gc,attr,str[i]);
 				break;
 		}
 	}
+	yascreen_gc_flush(s,gc,attr);
+	if (gc->str!=gc->sb)
+		free(gc->str);
+} // }}}
+
+static inline void yascreen_put_str(yascreen *s,int x,int y,uint32_t attr,const char *str,size_t len) { // {{{
+	// print at position, the cursor is left after the text and may be out of screen
+	yas_gc gc;
+
+	s->cursorx=x; // set cursor position to whatever is requested
+	s->cursory=y;
+
+	if (x>=s->sx||y>=s->sy) // somewhat successful print outside bounds
+		return;
+
+	gc.measure=0;
+	gc.full=0;
+	yascreen_gc_str(s,&gc,attr,str,len);
+} // }}}
+
+inline int yascreen_putsnxy(yascreen *s,int x,int y,uint32_t attr,const char *str,size_t len) { // {{{
+	if (!s)
+		return EOF;
+	if (!str)
+		return EOF;
+	if (attr&YAS_INTERNAL)
+		return EOF;
+
+	yascreen_put_str(s,x,y,attr,str,len);
+
 	s->cursorx=mymax(0,mymin(s->sx-1,s->cursorx)); // fixup position to be within screen
 	s->cursory=mymax(0,mymin(s->sy-1,s->cursory));
 	return 1;
 } // }}}
 
+inline int yascreen_putv(yascreen *s,const yas_put *ops,size_t n) { // {{{
+	size_t i;
+	int cnt=0;
+
+	if (!s)
+		return EOF;
+	if (!ops)
+		return EOF;
+
+	for (i=0;i<n;i++) {
+		const yas_put *op=ops+i;
+
+		if (!op->str||(op->attr&YAS_INTERNAL)) // skip invalid records
+			continue;
+		yascreen_put_str(s,op->x,op->y,op->attr,op->str,op->len);
+		cnt++;
+	}
+
+	s->cursorx=mymax(0,mymin(s->sx-1,s->cursorx)); // fixup position to be within screen
+	s->cursory=mymax(0,mymin(s->sy-1,s->cursory));
+	return cnt;
+} // }}}
+
+static inline uint32_t yascreen_cp_glyph(uint32_t cp) { // {{{
+	// glyph of a single codepoint; as in yascreen_putcw, control chars and invalid codepoints are shown as space
+	if (cp<=0x20||(cp>=0x7f&&cp<0xa0)||(cp>=0xd800&&cp<0xe000)||cp>0x10ffff)
+		return 0;
+	return cp;
+} // }}}
+
+inline int yascreen_putcells(yascreen *s,int x,int y,const yas_cell *cells,size_t n) { // {{{
+	int64_t e=(int64_t)x+(int64_t)n;
+	size_t o,k,h,c;
+
+	if (!s)
+		return EOF;
+	if (!cells)
+		return EOF;
+
+	s->cursorx=x;
+	s->cursory=y;
+
+	if (y>=0&&y<s->sy&&x<s->sx) {
+		int x1=mymax(0,x),x2=(int)mymin(e,(int64_t)s->sx),dirty=0;
+
+		s->cursorx=x2; // past the right edge all positions are the same
+		if (x1>=x2)
+			goto out;
+
+		o=yascreen_roff(s,&s->mem,y);
+		for (k=x1-x;k<(size_t)(x2-x);k=c) {
+			int64_t hx,cx;
+			uint32_t attr,g;
+
+			for (h=k;h>0&&!cells[h].ch;h--) // head of the char that covers k
+				;
+			g=yascreen_cp_glyph(cells[h].ch);
+			if (g) // the char spans the cells up to the next codepoint
+				for (c=k+1;c<n&&!cells[c].ch;c++)
+					;
+			else // a blank takes one cell; so do zero cells after a blank or without a head
+				h=k,c=k+1;
+
+			attr=cells[h].attr&~YAS_INTERNAL;
+			hx=x+(int64_t)h;
+			cx=x+(int64_t)c;
+			if (hx<0||cx>s->sx) { // wide char spanning a bound
+				uint32_t mark=hx<0?'<':'>';
+
+				for (hx=mymax(hx,0);hx<mymin(cx,(int64_t)s->sx)&&yascreen_cell_same(s,o,(int)hx,1,mark,attr);hx++)
+					;
+				if (hx<mymin(cx,(int64_t)s->sx)&&!dirty) {
+					dirty=1;
+					o=yascreen_woff(s,&s->mem,y);
+					yascreen_wide_cut(s,o,(int)hx,x2);
+				}
+				for (;hx<mymin(cx,(int64_t)s->sx);hx++) { // zap spanned chars
+					yascreen_free_memcell(s,o+hx);
+					s->mem.glyph[o+hx]=mark;
+					s->mem.style[o+hx]=attr;
+				}
+				continue;
+			}
+			if (yascreen_cell_same(s,o,(int)hx,(int)(cx-hx),g,attr)) // unchanged chars leave the line clean
+				continue;
+			if (!dirty) { // first change in the line
+				dirty=1;
+				o=yascreen_woff(s,&s->mem,y);
+				yascreen_wide_cut(s,o,(int)hx,x2);
+			}
+			yascreen_free_memcell(s,o+hx);
+			s->mem.glyph[o+hx]=g;
+			s->mem.style[o+hx]=attr;
+			for (hx++;hx<cx;hx++) {
+				yascreen_free_memcell(s,o+hx);
+				s->mem.style[o+hx]=attr|YAS_WTAIL;
+			}
+		}
+		if (dirty)
+			s->touched[y]=1;
+	}
+
+out:
+	s->cursorx=mymax(0,mymin(s->sx-1,s->cursorx)); // fixup position to be within screen
+	s->cursory=mymax(0,mymin(s->sy-1,s->cursory));
+	return 1;
+} // }}}
+
+static inline char yascreen_num_char(const char *digits,int len,char sign,int pre,int zer,int i) { // {{{
+	// char at column i of a number field: pre spaces, sign, zer zeroes, digits, spaces up to the field width
+	if (i<pre)
+		return ' ';
+	i-=pre;
+	if (sign) {
+		if (!i)
+			return sign;
+		i--;
+	}
+	if (i<zer)
+		return '0';
+	i-=zer;
+	if (i<len)
+		return digits[i];
+	return ' ';
+} // }}}
+
+static inline int yascreen_put_num(yascreen *s,int x,int y,uint32_t attr,int neg,uint64_t v,int prec,int width,int flags) { // {{{
+	// print a number with prec decimals in a field of at least width columns; only cells that change are stored
+	char nb[24],*p=nb+sizeof nb,sign=neg?'-':(flags&YAS_NUM_PLUS)?'+':0;
+	int i,len,w,pad,pre,zer;
+
+	if (!s)
+		return EOF;
+	if (attr&YAS_INTERNAL)
+		return EOF;
+	if (prec<0||prec>YAS_NUM_PREC)
+		return EOF;
+
+	for (i=0;v||i<=prec;i++) { // there is always a digit before the dot
+		if (i==prec&&prec)
+			*--p='.';
+		*--p=(char)('0'+v%10);
+		v/=10;
+	}
+	len=(int)(nb+sizeof nb-p);
+	w=mymax(width,len+!!sign); // like printf, a number that does not fit is printed in full
+	pad=w-len-!!sign;
+	pre=(flags&(YAS_NUM_LEFT|YAS_NUM_ZERO))?0:pad;
+	zer=((flags&(YAS_NUM_LEFT|YAS_NUM_ZERO))==YAS_NUM_ZERO)?pad:0;
+
+	s->cursorx=x;
+	s->cursory=y;
+
+	if (y>=0&&y<s->sy&&x<s->sx) {
+		int x1=mymax(0,x),x2=(int)mymin((int64_t)x+w,(int64_t)s->sx),dirty=0;
+		size_t o=yascreen_roff(s,&s->mem,y);
+
+		s->cursorx=x2; // past the right edge all positions are the same
+		for (i=x1;i<x2;i++) {
+			char c=yascreen_num_char(p,len,sign,pre,zer,(int)(i-(int64_t)x));
+			uint32_t g=c==' '?0:(uint32_t)c; // a space is 0
+
+			if (yascreen_cell_same(s,o,i,1,g,attr)) // unchanged digits stay clean
+				continue;
+			if (!dirty) { // first change in the line
+				dirty=1;
+				o=yascreen_woff(s,&s->mem,y);
+				yascreen_wide_cut(s,o,i,x2);
+			}
+			yascreen_free_memcell(s,o+i);
+			s->mem.glyph[o+i]=g;
+			s->mem.style[o+i]=attr;
+		}
+		if (dirty)
+			s->touched[y]=1;
+	}
+
+	s->cursorx=mymax(0,mymin(s->sx-1,s->cursorx)); // fixup position to be within screen
+	s->cursory=mymax(0,mymin(s->sy-1,s->cursory));
+	return w;
+} // }}}
+
+inline int yascreen_put_int(yascreen *s,int x,int y,uint32_t attr,int64_t v,int width,int flags) { // {{{
+	return yascreen_put_num(s,x,y,attr,v<0,v<0?0-(uint64_t)v:(uint64_t)v,0,width,flags);
+} // }}}
+
+inline int yascreen_put_u64(yascreen *s,int x,int y,uint32_t attr,uint64_t v,int width,int flags) { // {{{
+	return yascreen_put_num(s,x,y,attr,0,v,0,width,flags);
+} // }}}
+
+inline int yascreen_put_fixed(yascreen *s,int x,int y,uint32_t attr,int64_t v,int prec,int width,int flags) { // {{{
+	return yascreen_put_num(s,x,y,attr,v<0,v<0?0-(uint64_t)v:(uint64_t)v,prec,width,flags);
+} // }}}
+
+static inline void yascreen_gc_measure(yas_gc *gc,int room,int limit) { // {{{
+	// setup gc to measure a string
+	gc->measure=1;
+	gc->full=0;
+	gc->total=0;
+	gc->room=mymax(0,room);
+	gc->limit=mymax(0,limit);
+	gc->cut=(size_t)-1;
+} // }}}
+
+inline int yascreen_strwidth(yascreen *s,const char *str) { // {{{
+	yas_gc gc;
+
+	if (!s||!str)
+		return 0;
+
+	yascreen_gc_measure(&gc,INT_MAX,INT_MAX);
+	yascreen_gc_str(s,&gc,0,str,strlen(str));
+	return gc.total;
+} // }}}
+
+inline size_t yascreen_clip(yascreen *s,const char *str,int cols,const char *ell) { // {{{
+	yas_gc gc;
+	size_t len;
+
+	if (!s||!str)
+		return 0;
+
+	len=strlen(str);
+	yascreen_gc_measure(&gc,cols-(ell?yascreen_strwidth(s,ell):0),cols);
+	yascreen_gc_str(s,&gc,0,str,len);
+	if (!gc.full) // fits as a whole
+		return len;
+	return ell?gc.cut:gc.end;
+} // }}}
+
+inline int yascreen_putsxy(yascreen *s,int x,int y,uint32_t attr,const char *str) { // {{{
+	if (!str)
+		return EOF;
+
+	return yascreen_putsnxy(s,x,y,attr,str,strlen(str));
+} // }}}
+
 inline int yascreen_putsxyu(yascreen *s,int x,int y,uint32_t attr,const char *str) { // {{{
 	int rv,ny;
 
@@ -1221,38 +2766,30 @@ inline int yascreen_printxy(yascreen *s,int x,int y,uint32_t attr,const char *fo
 	va_list ap;
 	char *ns;
 	int size;
-	int rv;
 
 	va_start(ap,format);
-	size=yascreen_vasprintf(s,&ns,format,ap);
+	size=yascreen_vformat(s,&ns,format,ap);
 	va_end(ap);
 
 	if (size==-1) // some error, nothing more to do
 		return size;
 
-	rv=yascreen_putsxy(s,x,y,attr,ns);
-
-	free(ns);
-	return rv;
+	return yascreen_putsxy(s,x,y,attr,ns);
 } // }}}
 
 inline int yascreen_printxyu(yascreen *s,int x,int y,uint32_t attr,const char *format,...) { // {{{
 	va_list ap;
 	char *ns;
 	int size;
-	int rv;
 
 	va_start(ap,format);
-	size=yascreen_vasprintf(s,&ns,format,ap);
+	size=yascreen_vformat(s,&ns,format,ap);
 	va_end(ap);
 
 	if (size==-1) // some error, nothing more to do
 		return size;
 
-	rv=yascreen_putsxyu(s,x,y,attr,ns);
-
-	free(ns);
-	return rv;
+	return yascreen_putsxyu(s,x,y,attr,ns);
 } // }}}
 
 inline int yascreen_write(yascreen *s,const char *str,int len) { // {{{
@@ -1288,7 +2825,7 @@ inline int yascreen_print(yascreen *s,const char *format,...) { // {{{
 	int rv;
 
 	va_start(ap,format);
-	size=yascreen_vasprintf(s,&ns,format,ap);
+	size=yascreen_vformat(s,&ns,format,ap);
 	va_end(ap);
 
 	if (size==-1) // some error, nothing more to do
@@ -1296,7 +2833,6 @@ inline int yascreen_print(yascreen *s,const char *format,...) { // {{{
 
 	rv=yascreen_puts(s,ns);
 
-	free(ns);
 	if (s->lineflush)
 		outs(s,""); // request a flush
 	return rv;
@@ -1309,16 +2845,18 @@ inline const char *yascreen_clearln_s(yascreen *s __attribute__((unused))) { //
 // TODO: this should be removed on the next soname bump
 void yascreen_dump(yascreen *s); // exported for debugging w/o a public header declaration; keep the external definition in c99+ inline semantics
 inline void yascreen_dump(yascreen *s) { // {{{
+	char ub[5];
+	size_t o;
 	int i,j;
 
 	if (!s)
 		return;
 
-	printf("PSIZE: %zu\n",PSIZE);
+	printf("clusters: %u\n",s->clulive);
 
 	for (j=0;j<s->sy;j++)
-		for (i=0;i<s->sx;i++)
-			printf("x: %3d y: %3d len: %3zu attr: %08x s: %s\n",i,j,strlen((s->mem[i+(size_t)s->sx*j].style&YAS_STORAGE)?s->mem[i+(size_t)s->sx*j].p:s->mem[i+(size_t)s->sx*j].d),s->mem[i+(size_t)s->sx*j].style,(s->mem[i+(size_t)s->sx*j].style&YAS_STORAGE)?s->mem[i+(size_t)s->sx*j].p:s->mem[i+(size_t)s->sx*j].d);
+		for (i=0,o=yascreen_roff(s,&s->mem,j);i<s->sx;i++)
+			printf("x: %3d y: %3d len: %3zu attr: %08x s: %s\n",i,j,strlen(yascreen_cell_str(s,&s->mem,o+i,ub)),s->mem.style[o+i],yascreen_cell_str(s,&s->mem,o+i,ub));
 } // }}}
 
 inline void yascreen_redraw(yascreen *s) { // {{{
@@ -1502,18 +3040,58 @@ inline int yascreen_sy(yascreen *s) { // {{{
 	return s->sy;
 } // }}}
 
-inline int yascreen_x(yascreen *s) { // {{{
-	if (!s)
-		return -1;
+inline int yascreen_x(yascreen *s) { // {{{
+	if (!s)
+		return -1;
+
+	return s->cursorx;
+} // }}}
+
+inline int yascreen_y(yascreen *s) { // {{{
+	if (!s)
+		return -1;
+
+	return s->cursory;
+} // }}}
+
+static inline void yascreen_pushsize(yascreen *s,int key) { // {{{
+	// screen size notifications carry no data, so a single pending one is enough
+	int i;
+
+	for (i=0;i<s->keycnt;i++)
+		if (s->keys[i]==key)
+			return;
+	yascreen_pushch(s,key);
+} // }}}
+
+static inline void yascreen_winch_drain(void) { // {{{
+	char buf[64];
 
-	return s->cursorx;
+	while (read(winchpipe[0],buf,sizeof buf)>0) // the pipe is non-blocking
+		;
 } // }}}
 
-inline int yascreen_y(yascreen *s) { // {{{
-	if (!s)
-		return -1;
+static inline void yascreen_ckwinch(yascreen *s) { // {{{
+	sig_atomic_t gen=winchcnt;
+	struct winsize ws={0};
 
-	return s->cursory;
+	if (gen!=s->winchgen) { // a new SIGWINCH restarts the debounce period
+		s->winchgen=gen;
+		s->winchts=mytime();
+		s->winchpend=1;
+		yascreen_winch_drain();
+		return;
+	}
+	if (!s->winchpend)
+		return;
+	if (s->winchts+YAS_WINCH_TO>mytime())
+		return;
+	s->winchpend=0;
+	if (ioctl(STDOUT_FILENO,TIOCGWINSZ,&ws)||!ws.ws_col||!ws.ws_row)
+		return;
+	s->scrx=ws.ws_col;
+	s->scry=ws.ws_row;
+	yascreen_pushsize(s,YAS_SCREEN_SIZE);
 } // }}}
 
 inline void yascreen_ckto(yascreen *s) { // {{{
@@ -1522,6 +3100,16 @@ inline void yascreen_ckto(yascreen *s) { // {{{
 	if (!s)
 		return;
 
+	if (s->winch)
+		yascreen_ckwinch(s);
+	switch (s->state) { // only escape sequences time out, avoid reading the clock for every byte of regular input or a paste
+		case ST_NORM:
+		case ST_ENTER:
+		case ST_PASTE:
+			return;
+		default:
+			break;
+	}
 	now=mytime();
 
 	if (s->state==ST_ESC&&s->ansipos==1&&s->escto&&s->escts+s->escto<now) {
@@ -1554,32 +3142,36 @@ inline void yascreen_ckto(yascreen *s) { // {{{
 } // }}}
 
 inline uint64_t yascreen_willto(yascreen *s) { // {{{
-	int64_t now;
+	int64_t now,end=0;
 
 	if (!s)
 		return 0;
 
-	if (!s->escto)
+	if (s->escto)
+		switch (s->state) { // all escape sequence states time out
+			case ST_ESC:
+			case ST_ESC_ESC:
+			case ST_ESC_SQ:
+			case ST_ESC_SQ_D:
+			case ST_ESC_SQ_SQ:
+			case ST_ESC_SQ_M:
+			case ST_ESC_O:
+			case ST_ESC_O_D:
+				end=s->escts+s->escto;
+				break;
+			default:
+				break;
+		}
+	if (s->winchpend&&(!end||s->winchts+YAS_WINCH_TO<end)) // screen size change is reported when SIGWINCH settles
+		end=s->winchts+YAS_WINCH_TO;
+	if (!end)
 		return 0; // no timeout pending
-	switch (s->state) { // all escape sequence states time out
-		case ST_ESC:
-		case ST_ESC_ESC:
-		case ST_ESC_SQ:
-		case ST_ESC_SQ_D:
-		case ST_ESC_SQ_SQ:
-		case ST_ESC_SQ_M:
-		case ST_ESC_O:
-		case ST_ESC_O_D:
-			break;
-		default:
-			return 0; // no timeout pending
-	}
 
 	now=mytime();
-	if (s->escts+s->escto<=now)
+	if (end<=now)
 		return 1; // timeout already expired
 	else
-		return s->escts+s->escto-now;
+		return end-now;
 } // }}}
 
 static inline int yascreen_feed_telnet(yascreen *s,unsigned char c) { // {{{
@@ -1665,6 +3257,156 @@ static inline int yascreen_feed_telnet(yascreen *s,unsigned char c) { // {{{
 	return TELNET_NOOP;
 } // }}}
 
+static inline int yascreen_realloc_keys(yascreen *s) { // {{{
+	int64_t *tt;
+	uint8_t *tp;
+	int *tk;
+
+	if (!s)
+		return 1;
+
+	if (s->keysize<=s->keycnt) { // need to reallocate key storage
+		int newsize=s->keysize+KEYSTEP;
+
+		tk=(int *)realloc(s->keys,sizeof(int)*newsize);
+		if (!tk)
+			return 1;
+		s->keys=tk;
+		tt=(int64_t *)realloc(s->keyts,sizeof(int64_t)*newsize);
+		if (!tt) // keysize is not changed, the bigger key array is fine
+			return 1;
+		s->keyts=tt;
+		tp=(uint8_t *)realloc(s->keyp,sizeof(uint8_t)*newsize);
+		if (!tp)
+			return 1;
+		s->keyp=tp;
+		s->keysize=newsize;
+	}
+	return 0;
+} // }}}
+
+static inline int yascreen_push_key(yascreen *s,int key,uint8_t kp) { // {{{
+	// queue a key with its payload kind; returns non-zero if it could not be queued
+	if (yascreen_realloc_keys(s))
+		return 1;
+
+	s->keyts[s->keycnt]=mytime();
+	s->keyp[s->keycnt]=kp;
+	s->keys[s->keycnt++]=key;
+	return 0;
+} // }}}
+
+static inline void yascreen_paste_add(yascreen *s,const char *data,size_t len) { // {{{
+	if (s->plen+len>s->psize) { // grow geometrically, so that big pastes are not reallocated on every chunk
+		size_t nsize=s->psize?s->psize:4096;
+		char *np;
+
+		while (nsize<s->plen+len)
+			nsize*=2;
+		np=(char *)realloc(s->pbuf,nsize);
+		if (!np) { // a truncated paste is worse than none, the whole paste is dropped when it ends
+			s->plost=1;
+			return;
+		}
+		s->pbuf=np;
+		s->psize=nsize;
+	}
+	memcpy(s->pbuf+s->plen,data,len);
+	s->plen+=len;
+} // }}}
+
+static inline void yascreen_paste_done(yascreen *s,int key) { // {{{
+	// queue the collected paste and its key
+	// key is the ABI dependent value of YAS_PASTE
+	paste *p;
+
+	if (s->plost) { // some of the data is missing
+		s->plen=0;
+		s->plost=0;
+		return;
+	}
+	p=(paste *)calloc(1,sizeof *p);
+	if (!p) {
+		s->plen=0;
+		return;
+	}
+	if (yascreen_push_key(s,key,KP_PASTE)) {
+		free(p);
+		s->plen=0;
+		return;
+	}
+	p->data=s->pbuf; // the buffer is handed over as-is, there is no copy
+	p->len=s->plen;
+	s->pbuf=NULL;
+	s->plen=s->psize=0;
+	if (s->pastel)
+		s->pastel->next=p;
+	else
+		s->pastes=p;
+	s->pastel=p;
+} // }}}
+
+static inline void yascreen_push_mouse(yascreen *s,int key,const yas_mouse *m) { // {{{
+	// key is the ABI dependent value of YAS_MOUSE
+	if (m->action==YAS_MOUSE_MOVE&&s->keycnt&&s->keyp[s->keycnt-1]==KP_MOUSE) { // the last queued event is not retrieved yet
+		yas_mouse *l=s->mice+s->micecnt-1;
+
+		if (l->action==YAS_MOUSE_MOVE&&l->button==m->button&&l->mods==m->mods) { // coalesce motion, only the latest position matters
+			l->x=m->x;
+			l->y=m->y;
+			return;
+		}
+	}
+	if (s->micesize<=s->micecnt) { // need to reallocate mouse event storage
+		int newsize=s->micesize+MOUSESTEP;
+		yas_mouse *tm=(yas_mouse *)realloc(s->mice,sizeof(yas_mouse)*newsize);
+
+		if (!tm)
+			return;
+		s->mice=tm;
+		s->micesize=newsize;
+	}
+	if (yascreen_push_key(s,key,KP_MOUSE))
+		return;
+	s->mice[s->micecnt++]=*m;
+} // }}}
+
+static inline int yascreen_csi_params(yascreen *s,int *par,int *sub,int npar) { // {{{
+	// parse numeric parameters of the collected csi sequence
+	// the first sub-parameter after ':' of each parameter is stored in sub (0 if there is none) unless it is NULL, the rest are skipped
+	// returns the number of parameters or -1 if the sequence has a private prefix or is malformed
+	unsigned char *p=s->ansibuf+2;
+	int cnt=0;
+
+	if (*p<'0'||*p>'9')
+		return -1;
+	while (cnt<npar) {
+		int v=0;
+
+		while (*p>='0'&&*p<='9') {
+			if (v<=0x10ffff) // clamp, valid values are up to the last unicode code point
+				v=v*10+*p-'0';
+			p++;
+		}
+		par[cnt]=v;
+		if (sub) {
+			v=0;
+			if (*p==':')
+				while (*++p>='0'&&*p<='9')
+					if (v<=0x10ffff)
+						v=v*10+*p-'0';
+			sub[cnt]=v;
+		}
+		cnt++;
+		while (*p==':'||(*p>='0'&&*p<='9'))
+			p++;
+		if (*p!=';')
+			break;
+		p++;
+	}
+	return cnt;
+} // }}}
+
 #if YASCREEN_VERSIONED
 // non-inline declarations keep these external definitions in c99+ inline semantics; gnu89 is not affected
 void yascreen_feed_193(yascreen *s,unsigned char c);
@@ -1675,127 +3417,147 @@ int yascreen_peekch_193(yascreen *s);
 int yascreen_peekch_179(yascreen *s);
 #endif
 
-static inline int64_t yascreen_escslice(yascreen *s) { // {{{
-	// time in ms to the next esc sequence timeout event or 0 if esc timeout is disabled
-	uint64_t wrem=yascreen_willto(s);
-
-	if (!s->escto)
-		return 0;
-	return wrem?(int64_t)wrem:s->escto;
-} // }}}
-
-static inline int yascreen_getch_to_gen(yascreen *s,int timeout,int key_none) { // {{{
-	int64_t toms=timeout,tto,esl; // timeout is in milliseconds, same unit as escto
-	struct timeval to,*pto=&to;
+static inline int yascreen_wait_gen(yascreen *s,int timeout,int key_none) { // {{{
+	// wait for input to become available in the key buffer; returns non-zero if there is a stored key
+	// key_none selects the ABI version of the feed state machine
+	int64_t end=0,tto; // timeouts are in milliseconds, same unit as escto
+	struct timeval to;
 	fd_set r;
-	int sr;
-
-	if (!s)
-		return key_none;
+	int sr,nfds;
 
 	memset(&r,0,sizeof r); // make clang static analyzer happier (llvm bug #8920)
 
 	if (s->outcb) // we do not handle the input, so return immediately
 		timeout=-1;
-
-	if (timeout==0&&s->escto==0) // wait forever
-		pto=NULL;
-	else
-		if (timeout<0) // return immediately
-			toms=0;
-
-	esl=yascreen_escslice(s);
-	tto=esl?mymin(esl,timeout==0?esl:toms):toms;
-	if (toms)
-		toms-=tto; // remaining time to wait is in toms
-	to.tv_sec=tto/1000;
-	to.tv_usec=(tto%1000)*1000;
+	if (timeout>0)
+		end=mytime()+timeout;
 
 	for (;;) {
-		yascreen_ckto(s); // check for esc timeout to return it as a key
-		if (s->keycnt) { // check if we have stored key
-			int key=s->keys[0];
+		uint64_t wrem;
 
-			s->keycnt--;
-			memmove(s->keys,s->keys+1,sizeof(int)*s->keycnt);
-			return key;
-		}
+		yascreen_ckto(s); // check for esc or resize timeout to return it as a key
+		if (s->keycnt) // check if we have stored key
+			return 1;
 		if (s->outcb)
-			return key_none;
+			return 0;
 		if (STDOUT_FILENO<0)
-			return key_none;
+			return 0;
+		tto=-1; // wait forever
+		if (timeout<0) // return immediately
+			tto=0;
+		if (timeout>0) {
+			tto=end-mytime();
+			if (tto<=0) // timeout is finished
+				return 0;
+		}
+		wrem=yascreen_willto(s); // wake up for a pending esc or resize timeout
+		if (wrem&&(tto<0||(int64_t)wrem<tto))
+			tto=wrem;
+		to.tv_sec=tto/1000;
+		to.tv_usec=(tto%1000)*1000;
 		FD_ZERO(&r);
 		FD_SET(STDOUT_FILENO,&r);
-		sr=select(STDOUT_FILENO+1,&r,NULL,NULL,pto);
+		nfds=STDOUT_FILENO+1;
+		if (s->winch&&winchpipe[0]>=0) { // wake up on SIGWINCH even if it is delivered to another thread
+			FD_SET(winchpipe[0],&r);
+			nfds=mymax(nfds,winchpipe[0]+1);
+		}
+		sr=select(nfds,&r,NULL,NULL,tto<0?NULL:&to);
 		if (sr==-1) {
 			if (errno==EINTR) // signal interruption, retry
 				continue;
-			return key_none; // hard error (e.g. closed fd), do not spin forever
+			return 0; // hard error (e.g. closed fd), do not spin forever
 		}
 		if (sr>0) {
-			unsigned char c; // important to be unsigned, so codes>127 do not expand as negative int values
+			unsigned char c[256]; // important to be unsigned, so codes>127 do not expand as negative int values
 
+			if (s->winch&&winchpipe[0]>=0&&FD_ISSET(winchpipe[0],&r))
+				yascreen_winch_drain();
 			if (FD_ISSET(STDOUT_FILENO,&r)) {
-				ssize_t rr=read(STDOUT_FILENO,&c,sizeof c);
-
-				if (rr==sizeof c) {
-					#if YASCREEN_VERSIONED
-					if (key_none==YAS_K_NONE) // default behaviour, new symbols
-						yascreen_feed_193(s,c);
-					else
-						yascreen_feed_179(s,c);
-					#else
-					yascreen_feed(s,c);
-					#endif
+				ssize_t rr=read(STDOUT_FILENO,c,sizeof c); // take whatever is available, a paste should not cost a syscall per byte
+
+				if (rr>0) {
+					ssize_t i;
+
+					for (i=0;i<rr;i++)
+						#if YASCREEN_VERSIONED
+						if (key_none==YAS_K_NONE) // default behaviour, new symbols
+							yascreen_feed_193(s,c[i]);
+						else
+							yascreen_feed_179(s,c[i]);
+						#else
+						yascreen_feed(s,c[i]);
+						#endif
 					continue; // check if feed has yielded a key
 				}
 				if (rr==0) // eof/hangup, do not spin forever
-					return key_none;
+					return 0;
 				if (rr==-1&&errno!=EINTR&&errno!=EAGAIN&&errno!=EWOULDBLOCK) // hard error
-					return key_none;
+					return 0;
 			}
 			continue;
 		}
-		// sr==0 - the current slice expired; do not rely on select updating the timeval, that is not portable
-		if (pto) { // return because of timeout or rearm for the next slice
-			if (timeout<0) // nowait is set
-				return key_none;
-			if (!toms&&timeout>0) // timeout is finished
-				return key_none;
-			esl=yascreen_escslice(s);
-			if (!toms)
-				tto=esl?esl:s->escto;
-			else
-				tto=esl?mymin(esl,toms):toms;
-			if (toms)
-				toms-=tto; // remaining time to wait is in toms
-			to.tv_sec=tto/1000;
-			to.tv_usec=(tto%1000)*1000;
-		}
+		// sr==0 - the wait expired; an overall timeout is checked on the next iteration
+		if (timeout<0) // nowait is set
+			return 0;
 	}
 } // }}}
 
-symver_d(yascreen_getch_to_193,yascreen_getch_to,YASCREEN_1.93) // {{{
-inline int V(yascreen_getch_to,V193)(yascreen *s,int timeout) {
-	return yascreen_getch_to_gen(s,timeout,YAS_K_NONE);
+static inline void yascreen_drop_keys(yascreen *s,int cnt) { // {{{
+	// remove retrieved keys; their mouse events and pastes become the current ones
+	int i,m=0,p=0;
+
+	for (i=0;i<cnt;i++)
+		switch (s->keyp[i]) {
+			case KP_MOUSE:
+				s->mousecur=s->mice[m++];
+				s->havemouse=1;
+				break;
+			case KP_PASTE:
+				if (!p++) { // pastes of the previous retrieval are no longer valid
+					yascreen_free_pastes(s->pastecur);
+					s->pastecur=NULL;
+				}
+				yascreen_pop_paste(s);
+				s->havepaste=1;
+				break;
+		}
+	if (m) {
+		s->micecnt-=m;
+		memmove(s->mice,s->mice+m,sizeof(yas_mouse)*s->micecnt);
+	}
+	s->keycnt-=cnt;
+	memmove(s->keys,s->keys+cnt,sizeof(int)*s->keycnt);
+	memmove(s->keyts,s->keyts+cnt,sizeof(int64_t)*s->keycnt);
+	memmove(s->keyp,s->keyp+cnt,sizeof(uint8_t)*s->keycnt);
 } // }}}
 
-static inline int yascreen_realloc_keys(yascreen *s) { // {{{
-	int *tk;
+static inline int yascreen_getch_to_gen(yascreen *s,int timeout,int key_none) { // {{{
+	int key;
 
 	if (!s)
-		return 1;
+		return key_none;
 
-	if (s->keysize<=s->keycnt) { // need to reallocate key storage
-		int newsize=s->keysize+KEYSTEP;
+	if (!yascreen_wait_gen(s,timeout,key_none))
+		return key_none;
+	key=s->keys[0];
+	yascreen_drop_keys(s,1);
+	return key;
+} // }}}
 
-		tk=(int *)realloc(s->keys,sizeof(int)*newsize);
-		if (!tk)
-			return 1;
-		s->keys=tk;
-		s->keysize=newsize;
-	}
-	return 0;
+static inline int yascreen_peekch_gen(yascreen *s,int key_none) { // {{{
+	// the key is not dequeued, so it keeps its arrival time and payload
+	if (!s)
+		return key_none;
+
+	if (!yascreen_wait_gen(s,-1,key_none))
+		return key_none;
+	return s->keys[0];
+} // }}}
+
+symver_d(yascreen_getch_to_193,yascreen_getch_to,YASCREEN_1.93) // {{{
+inline int V(yascreen_getch_to,V193)(yascreen *s,int timeout) {
+	return yascreen_getch_to_gen(s,timeout,YAS_K_NONE);
 } // }}}
 
 inline void yascreen_ungetch(yascreen *s,int key) { // {{{
@@ -1806,7 +3568,11 @@ inline void yascreen_ungetch(yascreen *s,int key) { // {{{
 		return;
 
 	memmove(s->keys+1,s->keys,sizeof(int)*s->keycnt);
+	memmove(s->keyts+1,s->keyts,sizeof(int64_t)*s->keycnt);
+	memmove(s->keyp+1,s->keyp,sizeof(uint8_t)*s->keycnt);
 	s->keys[0]=key;
+	s->keyts[0]=mytime();
+	s->keyp[0]=KP_NONE;
 	s->keycnt++;
 } // }}}
 
@@ -1814,10 +3580,7 @@ inline void yascreen_pushch(yascreen *s,int key) { // {{{
 	if (!s)
 		return;
 
-	if (yascreen_realloc_keys(s))
-		return;
-
-	s->keys[s->keycnt++]=key;
+	yascreen_push_key(s,key,KP_NONE);
 } // }}}
 
 inline void yascreen_esc_to(yascreen *s,int timeout) { // {{{
@@ -1829,28 +3592,254 @@ inline void yascreen_esc_to(yascreen *s,int timeout) { // {{{
 
 symver_d(yascreen_peekch_193,yascreen_peekch,YASCREEN_1.93) // {{{
 inline int V(yascreen_peekch,V193)(yascreen *s) {
-	int ch=yascreen_getch_nowait(s);
-
-	if (ch!=YAS_K_NONE)
-		yascreen_ungetch(s,ch);
-	return ch;
+	return yascreen_peekch_gen(s,YAS_K_NONE);
 } // }}}
 
 inline void yascreen_clear_mem(yascreen *s,uint32_t attr) { // {{{
-	size_t i;
+	int y;
 
 	if (!s)
 		return;
-	attr&=~YAS_STORAGE;
+	attr&=~YAS_INTERNAL;
+
+	yascreen_cbuf_clear(s,&s->mem,attr);
+	for (y=0;y<s->sy;y++)
+		s->touched[y]=1; // mark all lines as touched, so that the next update repaints them
+	s->clearpend=1; // the next update may erase the terminal instead
+	s->clearattr=attr;
+} // }}}
+
+static inline void yascreen_shift_rows(yascreen *s,cbuf *b,int y1,int y2,int n) { // {{{
+	// move lines [y1,y2] up by n lines (down if negative), lines that move in are blank; only the row table changes
+	int y,h=y2-y1+1;
+
+	if (n>0) {
+		for (y=y1;y<y1+n;y++)
+			yascreen_blank_row(s,b,y);
+		memmove(b->row+y1,b->row+y1+n,(h-n)*sizeof *b->row);
+		for (y=y2-n+1;y<=y2;y++)
+			b->row[y]=0;
+	} else {
+		n=-n;
+		for (y=y2-n+1;y<=y2;y++)
+			yascreen_blank_row(s,b,y);
+		memmove(b->row+y1+n,b->row+y1,(h-n)*sizeof *b->row);
+		for (y=y1;y<y1+n;y++)
+			b->row[y]=0;
+	}
+} // }}}
+
+static inline int yascreen_queue_scroll(yascreen *s,int x1,int y1,int x2,int y2,int n) { // {{{
+	yas_scroll *q;
+
+	if (s->scrollcnt) { // scrolls of the same region in the same direction add up
+		q=&s->scrolls[s->scrollcnt-1];
+		if (q->x1==x1&&q->x2==x2&&q->y1==y1&&q->y2==y2&&(q->n>0)==(n>0)) {
+			q->n+=n;
+			q->n=mymax(y1-y2-1,mymin(y2-y1+1,q->n));
+			return 0;
+		}
+	}
+	if (s->scrollsize<=s->scrollcnt) { // need to reallocate scroll queue
+		int newsize=s->scrollsize+SCROLLSTEP;
+		yas_scroll *tq=(yas_scroll *)realloc(s->scrolls,sizeof(yas_scroll)*newsize);
+
+		if (!tq)
+			return -1;
+		s->scrolls=tq;
+		s->scrollsize=newsize;
+	}
+	q=&s->scrolls[s->scrollcnt++];
+	q->x1=x1;
+	q->x2=x2;
+	q->y1=y1;
+	q->y2=y2;
+	q->n=n;
+	return 0;
+} // }}}
+
+static inline void yascreen_shift_cells(yascreen *s,cbuf *b,int x1,int y1,int x2,int y2,int n) { // {{{
+	// move columns x1..x2 of lines y1..y2 up by n lines (down if negative), cells that move in are blank
+	int i,x,yd,ys,h=y2-y1+1,an=abs(n),w=x2-x1+1;
+	size_t od;
+
+	for (i=0;i<h;i++) { // in the direction of the move, so that sources are not overwritten before use
+		yd=(n>0)?y1+i:y2-i;
+		ys=yd+n;
+		if (i<an&&b->row[yd]&&s->storage) // content that is scrolled out
+			for (x=x1;x<=x2;x++)
+				yascreen_glyph_unref(s,b->glyph[yascreen_roff(s,b,yd)+x]);
+		if (i<h-an&&b->row[ys]) { // references move with the content
+			od=yascreen_woff(s,b,yd)+x1;
+			memcpy(b->style+od,b->style+yascreen_roff(s,b,ys)+x1,w*sizeof *b->style);
+			memcpy(b->glyph+od,b->glyph+yascreen_roff(s,b,ys)+x1,w*sizeof *b->glyph);
+		} else if (b->row[yd]) {
+			od=yascreen_roff(s,b,yd)+x1;
+			memset(b->style+od,0,w*sizeof *b->style);
+			memset(b->glyph+od,0,w*sizeof *b->glyph);
+		}
+	}
+} // }}}
+
+static inline void yascreen_wide_split(yascreen *s,size_t o,int x) { // {{{
+	// a wide char across the border between columns x-1 and x of the line at o is replaced by blanks
+	int h;
+
+	if (x<=0||x>=s->sx||!yascreen_is_wtail(s,o+x))
+		return;
+	for (h=x-1;h>0&&yascreen_is_wtail(s,o+h);h--)
+		;
+	yascreen_free_memcell(s,o+h); // keeps the style
+	for (h++;h<s->sx&&yascreen_is_wtail(s,o+h);h++) // tails hold no glyph
+		s->mem.style[o+h]&=~YAS_WTAIL;
+} // }}}
+
+inline int yascreen_scroll_rect(yascreen *s,int x1,int y1,int x2,int y2,int n) { // {{{
+	int y,h,term;
+
+	if (!s)
+		return -1;
+
+	x1=mymax(0,x1);
+	x2=mymin(s->sx-1,x2);
+	y1=mymax(0,y1);
+	y2=mymin(s->sy-1,y2);
+	if (x1>x2||y1>y2)
+		return -1;
+	h=y2-y1+1;
+	n=mymax(-h,mymin(h,n));
+	if (!n)
+		return 0;
+
+	if (!x1&&x2==s->sx-1) { // whole lines move, only the row tables change
+		yascreen_shift_rows(s,&s->mem,y1,y2,n);
+		if (!s->redraw&&!yascreen_queue_scroll(s,x1,y1,x2,y2,n)) { // the terminal is scrolled too, lines keep their state
+			yascreen_shift_rows(s,&s->scr,y1,y2,n);
+			if (n>0) {
+				memmove(s->touched+y1,s->touched+y1+n,(h-n)*sizeof *s->touched);
+				memset(s->touched+y2-n+1,0,n*sizeof *s->touched); // blank in both
+			} else {
+				memmove(s->touched+y1-n,s->touched+y1,(h+n)*sizeof *s->touched);
+				memset(s->touched+y1,0,-n*sizeof *s->touched);
+			}
+		} else // without terminal scroll the lines are repainted
+			for (y=y1;y<=y2;y++)
+				s->touched[y]=1;
+		return 0;
+	}
+
+	// terminals differ in what they do with a wide char across a margin, so scroll the terminal only if there is none
+	term=(s->caps&YAS_CAP_LRMM)&&!s->redraw;
+	for (y=y1;y<=y2;y++) {
+		if (s->mem.row[y]) {
+			yascreen_wide_split(s,yascreen_roff(s,&s->mem,y),x1);
+			yascreen_wide_split(s,yascreen_roff(s,&s->mem,y),x2+1);
+		}
+		if (term&&s->scr.row[y]) {
+			size_t o=yascreen_roff(s,&s->scr,y);
+
+			if ((x1&&s->scr.style[o+x1]&YAS_WTAIL)||(x2+1<s->sx&&s->scr.style[o+x2+1]&YAS_WTAIL))
+				term=0;
+		}
+		s->touched[y]=1; // the rest of the line stays in place
+	}
+	yascreen_shift_cells(s,&s->mem,x1,y1,x2,y2,n);
+	if (term&&!yascreen_queue_scroll(s,x1,y1,x2,y2,n)) // the terminal is scrolled too
+		yascreen_shift_cells(s,&s->scr,x1,y1,x2,y2,n);
+	return 0;
+} // }}}
+
+static inline int yascreen_clip_rect(yascreen *s,int x,int y,int w,int h,int *x1,int *y1,int *x2,int *y2) { // {{{
+	// intersect the rectangle at x,y of size w,h with the screen; returns 0 if nothing is left
+	*x1=mymax(0,x);
+	*y1=mymax(0,y);
+	*x2=(int)mymin((int64_t)x+w,(int64_t)s->sx)-1;
+	*y2=(int)mymin((int64_t)y+h,(int64_t)s->sy)-1;
+	return *x1<=*x2&&*y1<=*y2;
+} // }}}
+
+inline int yascreen_fill_rect(yascreen *s,int x,int y,int w,int h,uint32_t attr,uint32_t ch) { // {{{
+	int x1,y1,x2,y2,cw;
+	uint32_t g;
+	size_t o;
+
+	if (!s)
+		return -1;
+	if (w<=0||h<=0||!yascreen_clip_rect(s,x,y,w,h,&x1,&y1,&x2,&y2))
+		return -1;
+
+	attr&=~YAS_INTERNAL;
+	g=yascreen_cp_glyph(ch);
+	cw=g?yascreen_wcwidth(s,ch):1;
+	if (cw<1||cw>2) // zero width chars cannot fill a cell alone
+		g=0,cw=1;
+
+	for (y=y1;y<=y2;y++) {
+		o=yascreen_roff(s,&s->mem,y);
+		for (x=x1;x<=x2;x+=cw) // an odd cell at the end of a wide fill is blank
+			if (x+cw>x2+1?!yascreen_cell_same(s,o,x,1,0,attr):!yascreen_cell_same(s,o,x,cw,g,attr))
+				break;
+		if (x>x2) // the area already holds the fill, the line stays as it is
+			continue;
+		if (!g&&!attr&&!x1&&x2==s->sx-1) { // blank lines share the blank slot
+			yascreen_blank_row(s,&s->mem,y);
+			s->touched[y]=1;
+			continue;
+		}
+		o=yascreen_woff(s,&s->mem,y);
+		yascreen_wide_cut(s,o,x1,x2+1);
+		yascreen_free_cells(s,&s->mem,o+x1,x2-x1+1);
+		for (x=x1;x<=x2;x++)
+			s->mem.style[o+x]=attr;
+		if (cw==2) // wide chars fill pairs of cells, an odd cell at the end stays blank
+			for (x=x1;x<x2;x+=2) {
+				s->mem.glyph[o+x]=g;
+				s->mem.style[o+x+1]|=YAS_WTAIL;
+			}
+		else if (g)
+			for (x=x1;x<=x2;x++)
+				s->mem.glyph[o+x]=g;
+		s->touched[y]=1;
+	}
+	return 0;
+} // }}}
+
+inline int yascreen_set_attr_rect(yascreen *s,int x,int y,int w,int h,uint32_t mask,uint32_t attr) { // {{{
+	int x1,y1,x2,y2,a,b;
+	size_t o;
+
+	if (!s)
+		return -1;
+	if (w<=0||h<=0||!yascreen_clip_rect(s,x,y,w,h,&x1,&y1,&x2,&y2))
+		return -1;
 
-	for (i=0;i<(size_t)s->sx*s->sy;i++) {
-		if (s->mem[i].style&YAS_STORAGE)
-			free(s->mem[i].p);
-		s->mem[i].style=attr;
-		strncpy(s->mem[i].d," ",sizeof s->mem[i].d);
+	mask&=~YAS_INTERNAL;
+	attr&=mask;
+
+	for (y=y1;y<=y2;y++) {
+		o=yascreen_roff(s,&s->mem,y);
+		for (a=x1;a>0&&yascreen_is_wtail(s,o+a);a--) // wide chars change as a whole
+			;
+		for (b=x2;b+1<s->sx&&yascreen_is_wtail(s,o+b+1);b++)
+			;
+		for (x=a;x<=b;x++)
+			if (((s->mem.style[o+x]&~mask)|attr)!=s->mem.style[o+x])
+				break;
+		if (x>b) // nothing changes, the line stays as it is
+			continue;
+		o=yascreen_woff(s,&s->mem,y);
+		for (;x<=b;x++)
+			s->mem.style[o+x]=(s->mem.style[o+x]&~mask)|attr;
+		s->touched[y]=1;
 	}
-	for (i=0;i<(size_t)s->sy;i++) // mark all lines as touched, so that the next update repaints them
-		s->mem[(size_t)s->sx*i].style|=YAS_TOUCHED;
+	return 0;
+} // }}}
+
+inline int yascreen_scroll(yascreen *s,int y1,int y2,int n) { // {{{
+	if (!s)
+		return -1;
+
+	return yascreen_scroll_rect(s,0,y1,s->sx-1,y2,n);
 } // }}}
 
 inline void yascreen_getsize(yascreen *s,int *sx,int *sy) { // {{{
@@ -1942,18 +3931,122 @@ inline void yascreen_ungetwch(yascreen *s,wchar_t key) { // {{{
 } // }}}
 
 inline wchar_t yascreen_peekwch(yascreen *s) { // {{{
-	wchar_t ch;
+	wchar_t w;
+	int ch,i,len;
 
 	if (!s)
 		return YAS_K_NONE;
 	if (!s->isunicode)
 		return YAS_K_NONE;
 
-	ch=yascreen_getwch_nowait(s);
+	ch=yascreen_peekch_gen(s,YAS_K_NONE); // decode in place, the keys are not dequeued
+
+	if (ch==YAS_K_NONE||YAS_IS_CC(ch))
+		return ch;
+	if (ch>=0&&ch<=0x7f)
+		return ch;
+	len=((ch&0xe0)==0xc0)?2:((ch&0xf0)==0xe0)?3:((ch&0xf8)==0xf0)?4:0;
+	if (!len||s->keycnt<len) // unicode mode guarantees that we have a valid sequence, unless it is put back partially
+		return YAS_K_NONE;
+	w=ch&(0x7f>>len);
+	for (i=1;i<len;i++)
+		w=(w<<6)|(s->keys[i]&0x3f);
+	return w;
+} // }}}
+
+static inline int yascreen_key_mods(int key) { // {{{
+	// modifiers that are implied by a key code
+	if (key>=YAS_K_ALT(0)&&key<=YAS_K_ALT(0xff))
+		return YAS_MOD_ALT|((key>=YAS_K_A_A&&key<=YAS_K_A_Z)?YAS_MOD_SHIFT:0);
+	if ((key>=YAS_K_S_F1&&key<=YAS_K_S_F12)||(key>=YAS_K_S_LEFT&&key<=YAS_K_S_TAB)||(key>=YAS_K_S_HOME&&key<=YAS_K_S_PGDN))
+		return YAS_MOD_SHIFT;
+	if ((key>=YAS_K_C_F1&&key<=YAS_K_C_F12)||(key>=YAS_K_C_LEFT&&key<=YAS_K_C_RIGHT)||(key>=YAS_K_C_HOME&&key<=YAS_K_C_PGDN))
+		return YAS_MOD_CTRL;
+	if ((key>=YAS_K_A_F1&&key<=YAS_K_A_F12)||(key>=YAS_K_A_LEFT&&key<=YAS_K_A_RIGHT)||(key>=YAS_K_A_HOME&&key<=YAS_K_A_PGDN))
+		return YAS_MOD_ALT;
+	if (key>=YAS_K_NUL&&key<YAS_K_SPACE&&key!=YAS_K_TAB&&key!=YAS_K_RET&&key!=YAS_K_ESC)
+		return YAS_MOD_CTRL;
+	return 0;
+} // }}}
+
+inline int yascreen_getevents(yascreen *s,yas_event *ev,int n,int timeout) { // {{{
+	paste *p=NULL;
+	int i,k=0,m=0;
+
+	if (!s)
+		return -1;
+	if (!ev||n<=0)
+		return -1;
+
+	yascreen_free_pastes(s->pastecur); // pastes returned by the previous batch are no longer valid
+	s->pastecur=NULL;
+	s->havepaste=0;
 
-	if (ch!=YAS_K_NONE)
-		yascreen_ungetwch(s,ch);
-	return ch;
+	if (!yascreen_wait_gen(s,timeout,YAS_K_NONE))
+		return 0;
+
+	for (i=0;i<n&&k<s->keycnt;i++) { // decode everything that is already available, there is no wait after the first event
+		yas_event *e=ev+i;
+		int key=s->keys[k];
+		int kp=s->keyp[k];
+
+		memset(e,0,sizeof *e);
+		e->ts=s->keyts[k++];
+		e->key=key;
+		if (kp==KP_PASTE) { // queued pastes are in the same order as their keys
+			p=p?p->next:s->pastes;
+			e->type=YAS_EV_PASTE;
+			e->paste=p->data?p->data:"";
+			e->pastelen=p->len;
+			continue;
+		}
+		if (kp==KP_MOUSE) {
+			e->type=YAS_EV_MOUSE;
+			e->mouse=s->mice[m++];
+			e->mods=e->mouse.mods;
+			continue;
+		}
+		switch (key) {
+			case YAS_PASTE: // put back by the application, there is no data
+				e->type=YAS_EV_PASTE;
+				continue;
+			case YAS_MOUSE:
+				e->type=YAS_EV_MOUSE;
+				continue;
+			case YAS_SCREEN_SIZE:
+				e->sx=s->scrx;
+				e->sy=s->scry;
+				// fall through
+			case YAS_TELNET_SIZE:
+				e->type=YAS_EV_RESIZE;
+				continue;
+		}
+		e->type=YAS_EV_KEY;
+		e->mods=yascreen_key_mods(key);
+		if (s->isunicode&&key>=0xc0&&key<=0xf7) { // utf8 sequences are queued only when complete and valid
+			int j,len=(key>=0xf0)?4:(key>=0xe0)?3:2;
+
+			if (k+len-1>s->keycnt) // incomplete sequence (e.g. from yascreen_ungetch), return the byte as-is
+				len=1;
+			for (j=1;j<len;j++)
+				if ((s->keys[k+j-1]&~0x3f)!=0x80)
+					len=1;
+			e->text[0]=key;
+			if (len>1)
+				e->key=key&(0x7f>>len);
+			for (j=1;j<len;j++) {
+				e->text[j]=s->keys[k];
+				e->key=(e->key<<6)|(s->keys[k++]&0x3f);
+			}
+			continue;
+		}
+		if (key>=YAS_K_SPACE&&key<=0xff&&key!=YAS_K_BSP)
+			e->text[0]=key;
+	}
+	yascreen_drop_keys(s,k);
+	s->havemouse=0; // mouse events and pastes are already returned
+	s->havepaste=0;
+	return i;
 } // }}}
 
 // get yascreen_feed with the new symbol or unversioned
@@ -2089,6 +4182,8 @@ inline wchar_t yascreen_peekwch(yascreen *s) { // {{{
 #define YAS_K_A_z YAS_K_ALT('z')
 #define YAS_SCREEN_SIZE 0x800
 #define YAS_TELNET_SIZE 0x801
+#define YAS_PASTE 0x802
+#define YAS_MOUSE 0x803
 
 // }}}
 
@@ -2101,11 +4196,7 @@ inline int yascreen_getch_to_179(yascreen *s,int timeout) {
 
 symver_o(yascreen_peekch_179,yascreen_peekch,YASCREEN_1.79) // {{{
 inline int yascreen_peekch_179(yascreen *s) {
-	int ch=yascreen_getch_to_179(s,-1);
-
-	if (ch!=YAS_K_NONE)
-		yascreen_ungetch(s,ch);
-	return ch;
+	return yascreen_peekch_gen(s,YAS_K_NONE);
 } // }}}
 
 // now get yascreen_feed old version
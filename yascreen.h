@@ -30,6 +30,7 @@ extern "C" {
 #define YAS_INVERSE (1u<<(2*9+3))
 #define YAS_BOLD (1u<<(2*9+4))
 #define YAS_BLINK (1u<<(2*9+5))
+// bits 29-31 (0xe0000000) are for internal use; attributes that have them set are rejected or the bits are ignored
 // values representing default terminal's colors
 #define YAS_FGCOLORDEF 0
 #define YAS_BGCOLORDEF 0
@@ -56,6 +57,43 @@ extern "C" {
 #define YAS_NOECHO 4
 #define YAS_ONLCR 8
 
+// keyboard protocols
+#define YAS_KBD_MOK 1 // xterm modifyOtherKeys level 2
+#define YAS_KBD_CSIU 2 // progressive keyboard enhancement (CSI u), disambiguate escape codes and report alternate keys
+
+// terminal capabilities
+#define YAS_CAP_LRMM 1 // left and right margins (DECLRMM/DECSLRM), used to scroll rectangles
+#define YAS_CAP_BCE 2 // erase fills with the current background color (back color erase), used after yascreen_clear_mem
+#define YAS_CAP_SUSD 4 // scroll up/down (SU/SD) work inside a scroll region, used to scroll by more than one line at once
+
+// number field flags, see yascreen_put_int
+#define YAS_NUM_LEFT 1 // align to the left, default is to the right
+#define YAS_NUM_ZERO 2 // pad with zeroes after the sign instead of spaces before it; ignored with YAS_NUM_LEFT
+#define YAS_NUM_PLUS 4 // show + before positive numbers and zero
+#define YAS_NUM_PREC 19 // max number of decimals of yascreen_put_fixed
+
+// mouse tracking modes
+#define YAS_MOUSE_OFF 0
+#define YAS_MOUSE_CLICK 1 // report button presses and releases
+#define YAS_MOUSE_DRAG 2 // also report motion while a button is pressed
+#define YAS_MOUSE_MOTION 3 // report all motion
+
+// mouse event actions
+#define YAS_MOUSE_PRESS 0
+#define YAS_MOUSE_RELEASE 1
+#define YAS_MOUSE_MOVE 2
+
+// event types
+#define YAS_EV_KEY 1
+#define YAS_EV_PASTE 2
+#define YAS_EV_MOUSE 3
+#define YAS_EV_RESIZE 4
+
+// modifier bit masks
+#define YAS_MOD_SHIFT 1
+#define YAS_MOD_ALT 2
+#define YAS_MOD_CTRL 4
+
 #define YAS_K_ALT(code) (((code)&0xff)+0xf0101)
 
 #define YAS_IS_CC(code) ((code)>=0xf0000&&(code)<=0xffffd)
@@ -347,7 +385,7 @@ typedef enum {
 	YAS_K_A_x=YAS_K_ALT('x'),
 	YAS_K_A_y=YAS_K_ALT('y'),
 	YAS_K_A_z=YAS_K_ALT('z'),
-	// ALT+SHIFT+letter; YAS_K_A_O is defined for completeness but cannot be received, because \eO is a key sequence prefix
+	// ALT+SHIFT+letter; YAS_K_A_O can be received only with YAS_KBD_MOK or YAS_KBD_CSIU, because \eO is a key sequence prefix
 	YAS_K_A_A=YAS_K_ALT('A'),
 	YAS_K_A_B=YAS_K_ALT('B'),
 	YAS_K_A_C=YAS_K_ALT('C'),
@@ -376,8 +414,45 @@ typedef enum {
 	YAS_K_A_Z=YAS_K_ALT('Z'),
 	YAS_SCREEN_SIZE=0xf0701,
 	YAS_TELNET_SIZE=0xf0702,
+	YAS_PASTE=0xf0703,
+	YAS_MOUSE=0xf0704,
 } yas_keys;
 
+// mouse event, reported by YAS_MOUSE keypress
+typedef struct _yas_mouse {
+	int x,y; // zero based position
+	int button; // 0 none, 1 left, 2 middle, 3 right, 4/5 wheel up/down, 6/7 wheel left/right, 8-11 extra buttons
+	int action; // YAS_MOUSE_PRESS, YAS_MOUSE_RELEASE or YAS_MOUSE_MOVE
+	int mods; // YAS_MOD_* bitmask
+} yas_mouse;
+
+// input event, see yascreen_getevents
+typedef struct _yas_event {
+	int type; // YAS_EV_*
+	int key; // for YAS_EV_KEY same as returned by yascreen_getwch; YAS_PASTE, YAS_MOUSE, YAS_SCREEN_SIZE or YAS_TELNET_SIZE for the rest
+	int mods; // YAS_MOD_* bitmask, implied by the key code or reported with the mouse event
+	char text[8]; // zero terminated utf8 text of a character key
+	const char *paste; // pasted data for YAS_EV_PASTE, not zero terminated
+	size_t pastelen; // pasted data length
+	yas_mouse mouse; // mouse data for YAS_EV_MOUSE
+	int sx,sy; // reported screen size for YAS_SCREEN_SIZE
+	int64_t ts; // arrival time in milliseconds, monotonic clock
+} yas_event;
+
+// pre-decoded screen cell, see yascreen_putcells
+typedef struct _yas_cell {
+	uint32_t attr; // color and style
+	uint32_t ch; // unicode codepoint; 0 continues the wide char in the cell before it
+} yas_cell;
+
+// text to print at position, see yascreen_putv
+typedef struct _yas_put {
+	int x,y; // position
+	uint32_t attr; // color and style
+	const char *str; // text, does not need to be zero terminated
+	size_t len; // length of str in bytes
+} yas_put;
+
 struct _yascreen;
 typedef struct _yascreen yascreen;
 
@@ -394,9 +469,30 @@ void yascreen_set_unicode(yascreen *s,int on);
 void yascreen_set_telnet(yascreen *s,int on);
 // init remote telnet client
 void yascreen_init_telnet(yascreen *s);
+// enable/disable extended keyboard protocols (YAS_KBD_* bitmask, disabled by default)
+void yascreen_set_kbd(yascreen *s,int mode);
+// enable/disable treating east asian ambiguous width chars as wide (disabled by default)
+void yascreen_set_ambiwide(yascreen *s,int on);
+// set capabilities of the terminal that can be used for output (YAS_CAP_* bitmask, none by default)
+void yascreen_set_caps(yascreen *s,int caps);
+// enable/disable bracketed paste mode (disabled by default)
+void yascreen_set_paste(yascreen *s,int on);
+// get the pasted text of the last YAS_PASTE returned as keypress, each paste is returned once; data is not zero terminated
+// returned data is valid until the next YAS_PASTE with a paste or yascreen_getevents; returns NULL if there is no paste
+const char *yascreen_getpaste(yascreen *s,size_t *len);
+// set mouse tracking mode YAS_MOUSE_* (YAS_MOUSE_OFF by default)
+void yascreen_set_mouse(yascreen *s,int mode);
+// get the mouse event of the last YAS_MOUSE returned as keypress, each event is returned once; returns -1 if there is none
+int yascreen_getmouse(yascreen *s,yas_mouse *m);
+// enable/disable built-in SIGWINCH handling (disabled by default); works only for terminal output
+// a screen size change is reported as YAS_SCREEN_SIZE once the signals settle; returns -1 on failure
+int yascreen_set_winch(yascreen *s,int on);
 // resize screen; should redraw afterwards
 // since allocation is involved, this may fail and return -1
 int yascreen_resize(yascreen *s,int sx,int sy);
+// resize screen keeping the content of the common area; only newly exposed cells are repainted
+// use only with terminals that do not reflow the content on resize
+int yascreen_resize_keep(yascreen *s,int sx,int sy);
 // free screen data
 void yascreen_free(yascreen *s);
 
@@ -414,6 +510,23 @@ void yascreen_term_set(yascreen *s,int mode);
 // print at position, if data exceeds buffer, then it gets truncated
 int yascreen_printxy(yascreen *s,int x,int y,uint32_t attr,const char *format,...) __attribute__((format(printf,5,6)));
 int yascreen_putsxy(yascreen *s,int x,int y,uint32_t attr,const char *str);
+// print len bytes of str at position, str does not need to be zero terminated; data exceeding buffer gets truncated
+int yascreen_putsnxy(yascreen *s,int x,int y,uint32_t attr,const char *str,size_t len);
+// print n records of text at position in one call; returns the number of records printed, invalid ones are skipped
+int yascreen_putv(yascreen *s,const yas_put *ops,size_t n);
+// put n pre-decoded cells at position, one cell per column; cells outside the screen are skipped
+int yascreen_putcells(yascreen *s,int x,int y,const yas_cell *cells,size_t n);
+// print a number right aligned in a field of at least width columns, see YAS_NUM_*; no format string is parsed
+// only cells that change are stored; returns the field width
+int yascreen_put_int(yascreen *s,int x,int y,uint32_t attr,int64_t v,int width,int flags);
+int yascreen_put_u64(yascreen *s,int x,int y,uint32_t attr,uint64_t v,int width,int flags);
+// same as yascreen_put_int for v/10^prec, printed with prec decimals (e.g. 12345 with prec 2 is 123.45)
+int yascreen_put_fixed(yascreen *s,int x,int y,uint32_t attr,int64_t v,int prec,int width,int flags);
+// width of str in columns, as it would be printed on one line
+int yascreen_strwidth(yascreen *s,const char *str);
+// length in bytes of the longest part of str that fits in cols columns; if str does not fit and ell is not NULL
+// the part leaves room for ell to be printed after it
+size_t yascreen_clip(yascreen *s,const char *str,int cols,const char *ell);
 // print at position, if data exceeds buffer, then it gets truncated; and update immediately
 int yascreen_printxyu(yascreen *s,int x,int y,uint32_t attr,const char *format,...) __attribute__((format(printf,5,6)));
 int yascreen_putsxyu(yascreen *s,int x,int y,uint32_t attr,const char *str);
@@ -425,6 +538,16 @@ int yascreen_update(yascreen *s);
 void yascreen_redraw(yascreen *s);
 // clear memory buffer
 void yascreen_clear_mem(yascreen *s,uint32_t attr);
+// scroll lines y1..y2 up by n lines (down if n is negative); new lines are blank
+// the terminal is scrolled on next update, so only the new lines are repainted
+int yascreen_scroll(yascreen *s,int y1,int y2,int n);
+// scroll columns x1..x2 of lines y1..y2 up by n lines (down if n is negative); new cells are blank
+// the terminal is scrolled on next update only with YAS_CAP_LRMM, otherwise the rectangle is repainted
+int yascreen_scroll_rect(yascreen *s,int x1,int y1,int x2,int y2,int n);
+// fill w columns of h lines starting at x,y with codepoint ch (0 or space for blank) in attr
+int yascreen_fill_rect(yascreen *s,int x,int y,int w,int h,uint32_t attr,uint32_t ch);
+// change the style bits in mask of w columns of h lines starting at x,y to these in attr; content does not change
+int yascreen_set_attr_rect(yascreen *s,int x,int y,int w,int h,uint32_t mask,uint32_t attr);
 
 // calls suitable for line mode and init of fullscreen mode
 
@@ -479,6 +602,10 @@ int yascreen_getch_to(yascreen *s,int timeout);
 #define yascreen_getch(s) yascreen_getch_to(s,0)
 // negative timeout=do not wait
 #define yascreen_getch_nowait(s) yascreen_getch_to(s,-1)
+// wait for input, then get up to n available events in one call; wait no more than timeout in milliseconds
+// zero timeout=wait forever, negative timeout=do not wait; returns the number of events, 0 on timeout
+// paste data is valid until the next call to yascreen_getevents or the next YAS_PASTE returned as keypress
+int yascreen_getevents(yascreen *s,yas_event *ev,int n,int timeout);
 // put back key value in key buffer
 void yascreen_ungetch(yascreen *s,int key);
 // push key value at end of key buffer
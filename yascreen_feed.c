@@ -9,6 +9,91 @@
 // yascreen is free software, released under the terms of GNU Lesser General Public License v3.0 or later
 // }}}
 
+static inline void V(yascreen_feed_modkey,V193)(yascreen *s,int code,int shifted,int mod) { // {{{
+	// push a key reported by CSI u or modifyOtherKeys as a unicode code point and a modifier value
+	// shifted is the code point with shift applied as reported with alternate keys, 0 if not known
+	// mod is 1+bitmask of shift(1), alt(2), ctrl(4), super(8), hyper(16), meta(32), caps lock(64) and num lock(128)
+	mod=mod>1?(mod-1)&~(64|128):0; // lock states do not change the key
+	if (mod&~(1|2|4)) // there are no key codes for super/hyper/meta combinations
+		return;
+	if ((mod&1)&&shifted>0) { // shift is already applied, e.g. alt-shift-1 is alt-!
+		code=shifted;
+		mod&=~1;
+	}
+
+	switch (code) {
+		case YAS_K_ESC:
+			if (!mod)
+				yascreen_pushch(s,YAS_K_ESC);
+			return;
+		case YAS_K_RET:
+			if (!mod)
+				yascreen_pushch(s,YAS_K_RET);
+			if (mod==2)
+				yascreen_pushch(s,YAS_K_A_RET);
+			return;
+		case YAS_K_TAB:
+			if (!mod)
+				yascreen_pushch(s,YAS_K_TAB);
+			if (mod==1)
+				yascreen_pushch(s,YAS_K_S_TAB);
+			if (mod==2)
+				yascreen_pushch(s,YAS_K_A_TAB);
+			return;
+		case YAS_K_BSP:
+		case YAS_K_C_H:
+			if (!mod)
+				yascreen_pushch(s,YAS_K_BSP);
+			if (mod==2)
+				yascreen_pushch(s,YAS_K_A_BSP);
+			if (mod==4)
+				yascreen_pushch(s,YAS_K_C_H);
+			return;
+	}
+	if (code>=0x20&&code<0x7f) { // ascii keys are reported unshifted
+		if ((mod&1)&&code>='a'&&code<='z')
+			code-=0x20;
+		switch (mod&~1) {
+			case 0:
+				yascreen_pushch(s,code);
+				break;
+			case 2: // alt
+				yascreen_pushch(s,YAS_K_ALT(code));
+				break;
+			case 4: // ctrl
+				if ((code>='@'&&code<='_')||(code>='a'&&code<='z'))
+					yascreen_pushch(s,code&0x1f);
+				if (code==' '||code=='2')
+					yascreen_pushch(s,YAS_K_NUL);
+				if (code>='3'&&code<='7')
+					yascreen_pushch(s,code-'3'+YAS_K_C_3);
+				if (code=='8'||code=='?')
+					yascreen_pushch(s,YAS_K_C_8);
+				break;
+		}
+		return;
+	}
+	if (mod||code<0xa0||(code>=0xd800&&code<=0xdfff)||(code>=0xe000&&code<=0xf8ff)||code>0x10ffff) // modified text, controls, surrogates or private use (functional keys)
+		return;
+	if (!s->isunicode) {
+		if (code<=0xff)
+			yascreen_pushch(s,code);
+		return;
+	}
+	if (code<0x800)
+		yascreen_pushch(s,0xc0|(code>>6));
+	else {
+		if (code<0x10000)
+			yascreen_pushch(s,0xe0|(code>>12));
+		else {
+			yascreen_pushch(s,0xf0|(code>>18));
+			yascreen_pushch(s,0x80|((code>>12)&0x3f));
+		}
+		yascreen_pushch(s,0x80|((code>>6)&0x3f));
+	}
+	yascreen_pushch(s,0x80|(code&0x3f));
+} // }}}
+
 symver_V(V(yascreen_feed,V193),yascreen_feed,YASCREEN_193) // {{{
 inline void V(yascreen_feed,V193)(yascreen *s,unsigned char c) {
 	if (!s)
@@ -26,15 +111,37 @@ inline void V(yascreen_feed,V193)(yascreen *s,unsigned char c) {
 			case TELNET_NOOP: // byte is eaten w/o valid input
 				return;
 			case TELNET_SIZE: // notify about screen size change w/o valid size data
-				yascreen_pushch(s,YAS_TELNET_SIZE);
+				yascreen_pushsize(s,YAS_TELNET_SIZE);
 				return;
 			case TELNET_SIZE_NAWS: // new valid screen size is received via NAWS
-				yascreen_pushch(s,YAS_SCREEN_SIZE);
+				yascreen_pushsize(s,YAS_SCREEN_SIZE);
 				return;
 		}
 	}
 
 	switch (s->state) {
+		case ST_PASTE: {
+			static const char pend[]=ESC"[201~";
+
+			if ((unsigned char)pend[s->pendpos]==c) {
+				if (++s->pendpos<sizeof pend-1)
+					break;
+				s->pendpos=0;
+				s->state=ST_NORM;
+				yascreen_paste_done(s,YAS_PASTE);
+				break;
+			}
+			if (s->pendpos) { // partial end marker turns out to be payload
+				yascreen_paste_add(s,pend,s->pendpos);
+				s->pendpos=0;
+				if (c==YAS_K_ESC) {
+					s->pendpos=1;
+					break;
+				}
+			}
+			yascreen_paste_add(s,(char *)&c,1);
+			break;
+		}
 		case ST_ENTER:
 			if ((c=='\n'||c==0)&&s->escts+YAS_ENTER_TO>=mytime()) // ignore LF/NUL combinations arriving shortly after CR
 				break;
@@ -581,7 +688,47 @@ inline void V(yascreen_feed,V193)(yascreen *s,unsigned char c) {
 							if (s->ansibuf[2]=='6')
 								yascreen_pushch(s,YAS_K_A_PGDN);
 						}
+						if (s->ansipos==6&&s->ansibuf[2]=='2'&&s->ansibuf[3]=='0'&&s->ansibuf[4]=='0') { // bracketed paste start - \e[200~
+							s->pendpos=0;
+							s->plen=0;
+							s->plost=0;
+							s->state=ST_PASTE;
+						}
+						if (s->ansipos>8&&s->ansibuf[2]=='2'&&s->ansibuf[3]=='7'&&s->ansibuf[4]==';') { // modifyOtherKeys - \e[27;<mod>;<code>~
+							int par[3];
+
+							if (yascreen_csi_params(s,par,NULL,3)==3)
+								V(yascreen_feed_modkey,V193)(s,par[2],0,par[1]);
+						}
+						break;
+					case 'M': // sgr mouse press or motion - \e[<b;x;yM
+					case 'm': { // sgr mouse release - \e[<b;x;ym
+						int b,x,y;
+
+						if (s->ansibuf[2]=='<'&&3==sscanf((char *)s->ansibuf+3,"%d;%d;%d",&b,&x,&y)&&b>=0&&x>0&&y>0) {
+							yas_mouse m;
+
+							m.x=x-1;
+							m.y=y-1;
+							if (b&64) // wheel
+								m.button=4+(b&3);
+							else if (b&128) // extra buttons
+								m.button=8+(b&3);
+							else
+								m.button=(b&3)==3?0:(b&3)+1;
+							m.action=(c=='m')?YAS_MOUSE_RELEASE:(b&32)?YAS_MOUSE_MOVE:YAS_MOUSE_PRESS;
+							m.mods=((b&4)?YAS_MOD_SHIFT:0)|((b&8)?YAS_MOD_ALT:0)|((b&16)?YAS_MOD_CTRL:0);
+							yascreen_push_mouse(s,YAS_MOUSE,&m);
+						}
 						break;
+					}
+					case 'u': { // progressive keyboard enhancement - \e[<code>u \e[<code>;<mod>u \e[<code>:<shifted>;<mod>u
+						int par[2]={0,1},sub[2]={0,0};
+
+						if (yascreen_csi_params(s,par,sub,2)>0) // a '?' prefixed flags report is ignored
+							V(yascreen_feed_modkey,V193)(s,par[0],sub[0],par[1]);
+						break;
+					}
 					case '^': // rxvt ctrl-navigation
 						if (s->ansipos==4&&s->ansibuf[2]=='2') // ctrl-ins - \e[2^
 							yascreen_pushch(s,YAS_K_C_INS);
@@ -633,7 +780,7 @@ inline void V(yascreen_feed,V193)(yascreen *s,unsigned char c) {
 							s->scrx=sx;
 							s->scry=sy;
 							s->haveansi=1;
-							yascreen_pushch(s,YAS_SCREEN_SIZE);
+							yascreen_pushsize(s,YAS_SCREEN_SIZE);
 						} else if (!strcmp((char *)s->ansibuf+2,"1;2R")) // shift-F3 - \e[1;2R
 							yascreen_pushch(s,YAS_K_S_F3);
 						else if (!strcmp((char *)s->ansibuf+2,"1;5R")) // ctrl-F3 - \e[1;5R
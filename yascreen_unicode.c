@@ -0,0 +1,859 @@
+// $Id: yascreen_unicode.c,v 1.1 2026/10/18 12:00:00 bbonev Exp $
+//
+// generated by mkunicode.pl from unicode 14.0.0 data, do not edit
+//
+// Copyright © 2015-2026 Boian Bonev (bbonev@ipacct.com) {{{
+//
+// SPDX-License-Identifer: LGPL-3.0-or-later
+//
+// This file is part of yascreen - yet another screen library.
+//
+// yascreen is free software, released under the terms of GNU Lesser General Public License v3.0 or later
+// }}}
+
+// property of a code point is a byte: bits 0-1 width (0 - zero width, 1 - narrow, 2 - wide, 3 - east asian ambiguous)
+// bits 2-5 grapheme cluster break (YAS_GB_*)
+// code point bits: 13 top index, 6 middle index, 2 leaf byte; 13032 bytes in total
+
+#define YAS_GB_OTHER 0
+#define YAS_GB_CR 1
+#define YAS_GB_LF 2
+#define YAS_GB_CONTROL 3
+#define YAS_GB_EXTEND 4
+#define YAS_GB_ZWJ 5
+#define YAS_GB_RI 6
+#define YAS_GB_PREPEND 7
+#define YAS_GB_SPACINGMARK 8
+#define YAS_GB_L 9
+#define YAS_GB_V 10
+#define YAS_GB_T 11
+#define YAS_GB_LV 12
+#define YAS_GB_LVT 13
+#define YAS_GB_EXTPICT 14
+
+#define YAS_UP_LBITS 2
+#define YAS_UP_MBITS 6
+
+static const uint8_t yas_up_top[4352]={
+	0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,
+	16,17,18,19,18,18,18,20,21,22,23,24,25,26,18,18,
+	27,28,29,30,31,32,33,34,18,35,18,36,37,38,39,40,
+	41,42,43,44,44,44,44,44,44,44,44,44,44,44,44,44,
+	44,44,44,44,44,44,44,44,44,44,44,44,44,45,44,44,
+	44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,
+	44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,
+	44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,
+	44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,
+	44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,
+	44,44,44,44,46,18,47,18,48,49,50,51,52,53,54,55,
+	56,57,58,52,53,54,55,56,57,58,52,53,54,55,56,57,
+	58,52,53,54,55,56,57,58,52,53,54,55,56,57,58,52,
+	53,54,55,56,57,58,52,59,18,18,18,18,18,18,18,18,
+	60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+	60,60,60,60,60,60,60,60,60,44,44,61,18,18,62,63,
+	18,64,65,66,18,18,18,18,18,18,67,18,18,68,69,70,
+	71,72,73,74,75,76,77,78,79,80,81,18,82,83,84,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,85,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,86,87,18,18,18,88,
+	44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,
+	44,44,44,44,44,44,44,89,44,44,44,44,90,91,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,92,
+	44,93,94,18,18,18,18,18,18,18,18,18,95,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,96,
+	18,97,98,18,18,18,18,18,18,18,99,18,18,18,18,18,
+	100,87,101,18,18,18,18,18,102,103,18,18,18,18,18,18,
+	104,105,106,107,108,109,110,111,112,113,114,18,115,115,115,116,
+	44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,
+	44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,
+	44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,
+	44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,
+	44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,
+	44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,
+	44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,
+	44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,
+	44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,
+	44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,
+	44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,
+	44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,
+	44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,
+	44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,
+	44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,
+	44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,117,
+	44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,
+	44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,
+	44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,
+	44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,
+	44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,
+	44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,
+	44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,
+	44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,
+	44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,
+	44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,
+	44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,
+	44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,
+	44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,
+	44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,
+	44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,
+	44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,117,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	118,119,120,120,120,120,120,120,120,120,120,120,120,120,120,120,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+	60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+	60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+	60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+	60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+	60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+	60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+	60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+	60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+	60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+	60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+	60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+	60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+	60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+	60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+	60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,121,
+	60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+	60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+	60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+	60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+	60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+	60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+	60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+	60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+	60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+	60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+	60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+	60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+	60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+	60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+	60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+	60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,121,
+};
+
+static const uint8_t yas_up_mid[7808]={
+	0,0,1,2,0,0,0,0,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,4,
+	0,0,0,0,0,0,0,0,5,6,7,8,9,10,11,9,
+	3,12,3,3,13,14,13,15,16,12,11,16,10,14,11,17,
+	5,3,3,3,18,3,14,3,3,15,14,3,19,3,13,14,
+	11,13,9,5,15,3,3,3,3,15,14,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,12,17,17,17,13,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,5,3,3,3,5,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,6,19,5,13,3,9,18,3,3,3,3,3,3,3,3,
+	20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+	20,20,20,20,20,20,20,20,20,20,20,20,3,3,3,3,
+	3,3,3,3,19,9,9,9,21,9,16,3,19,9,9,9,
+	21,9,16,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	5,3,3,3,9,9,9,9,9,9,9,9,9,9,9,9,
+	9,9,9,9,5,3,3,3,3,3,3,3,3,3,3,3,
+	22,20,23,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,24,20,20,20,20,20,20,20,20,20,20,25,
+	26,25,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	27,28,3,3,20,20,29,30,3,3,3,3,3,3,3,3,
+	3,3,22,20,20,20,20,20,3,3,3,3,31,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,32,20,33,20,34,35,23,3,3,3,3,
+	3,3,3,36,37,3,3,3,3,3,3,3,20,20,20,20,
+	20,20,29,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,32,20,20,31,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,22,20,20,3,3,37,
+	3,3,3,3,3,32,25,20,20,24,24,23,3,3,3,3,
+	3,3,3,3,3,3,24,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,28,3,20,20,3,3,3,3,3,3,3,3,
+	3,3,32,20,20,20,20,20,38,20,20,20,20,20,20,20,
+	39,3,3,3,3,3,3,3,3,3,3,3,3,3,40,41,
+	42,20,43,44,24,20,3,3,32,3,3,3,3,3,3,3,
+	45,3,3,3,3,3,3,3,3,3,3,3,3,3,3,46,
+	42,47,48,49,3,50,3,3,32,3,3,3,3,3,3,51,
+	52,3,3,3,3,3,3,3,3,3,3,3,3,3,3,41,
+	53,22,34,23,37,3,3,3,3,3,3,3,23,37,3,3,
+	52,3,3,3,3,3,3,3,3,3,3,3,3,3,3,41,
+	42,25,54,49,3,3,3,3,32,3,3,3,3,3,32,20,
+	45,3,3,3,3,3,3,3,3,3,3,3,3,3,3,55,
+	42,47,48,49,3,56,3,3,32,3,3,3,3,3,3,3,
+	51,3,3,3,3,3,3,3,3,3,3,3,3,3,3,57,
+	58,59,60,49,3,50,3,3,3,3,3,3,3,3,3,3,
+	43,31,3,3,3,3,3,3,3,3,3,3,3,3,3,35,
+	43,61,35,23,3,26,3,3,32,3,3,3,3,3,3,3,
+	45,3,3,3,3,3,3,3,3,3,3,3,3,3,3,62,
+	63,64,60,23,3,65,3,3,32,3,3,3,3,3,3,3,
+	66,3,3,3,3,3,3,3,3,3,3,3,3,3,22,46,
+	42,41,60,67,3,50,3,3,32,3,3,3,3,3,3,3,
+	45,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,51,50,68,69,70,71,3,3,3,3,59,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,72,20,29,3,
+	3,22,20,29,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,72,20,20,31,
+	3,3,20,23,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,23,3,3,3,3,3,3,73,37,59,
+	3,3,3,3,3,3,3,3,3,3,3,3,24,20,20,39,
+	20,35,3,24,20,20,24,20,20,20,20,20,20,20,20,31,
+	3,51,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,24,74,20,52,53,
+	3,3,3,3,3,59,23,32,31,3,3,3,24,31,3,3,
+	51,53,3,37,3,3,3,37,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,
+	75,75,75,75,75,75,75,75,76,76,76,76,76,76,76,76,
+	76,76,76,76,76,76,76,76,76,76,77,77,77,77,77,77,
+	77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,24,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,32,78,3,3,3,3,3,3,32,79,3,3,
+	3,3,3,3,32,3,3,3,3,3,3,3,32,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,80,20,66,
+	70,81,42,20,20,3,3,37,3,3,3,3,3,3,3,3,
+	3,3,22,82,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,26,3,3,3,3,3,3,3,3,37,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,39,83,43,3,81,70,42,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,22,84,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,85,20,29,69,24,20,43,83,20,20,34,
+	3,3,3,3,3,3,3,3,3,3,3,3,20,20,20,20,
+	20,20,20,29,3,3,3,3,3,3,3,3,3,3,3,3,
+	20,79,3,3,3,3,3,3,3,3,3,3,3,86,39,43,
+	81,79,3,3,3,3,3,3,3,3,22,20,20,3,3,3,
+	87,3,3,3,3,3,3,3,88,66,80,23,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,40,66,89,66,3,3,3,
+	3,3,3,3,3,3,3,3,3,70,70,20,20,68,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,29,20,20,20,74,20,31,37,3,47,23,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+	3,3,90,91,6,11,16,16,11,9,92,93,10,5,14,94,
+	3,3,95,3,3,3,3,3,96,97,96,96,3,13,3,14,
+	19,13,3,3,3,3,3,3,3,3,3,13,3,3,3,3,
+	3,3,3,3,20,20,20,20,20,20,20,20,31,3,3,3,
+	14,5,5,3,14,12,3,3,98,12,14,3,3,3,95,3,
+	3,3,3,3,14,13,14,11,9,9,9,3,9,9,16,3,
+	3,3,5,3,9,99,100,3,3,3,101,3,3,3,16,3,
+	3,3,3,3,12,13,3,3,3,14,3,3,3,3,3,3,
+	10,14,6,14,5,5,12,19,6,18,9,17,3,9,3,16,
+	3,3,13,13,12,3,3,3,16,9,15,15,3,3,3,3,
+	15,15,3,3,3,5,5,3,3,5,3,3,3,3,3,14,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,12,3,102,3,3,3,103,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,104,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,105,3,3,3,3,3,3,106,107,108,3,109,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,9,9,9,9,9,9,9,9,
+	9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+	110,9,9,9,9,9,9,9,9,9,21,9,9,9,9,9,
+	9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+	9,9,9,3,9,9,9,9,9,9,9,9,9,3,3,3,
+	9,9,9,9,15,16,3,3,21,9,111,3,15,112,3,16,
+	113,15,6,15,16,3,3,3,15,16,3,14,3,3,105,114,
+	115,116,117,118,109,119,115,120,115,115,115,115,115,115,115,115,
+	120,115,121,121,121,115,115,115,122,122,123,122,115,115,115,124,
+	115,125,3,3,124,115,115,118,126,115,127,115,115,115,115,128,
+	115,129,99,130,99,131,99,99,122,115,130,99,132,133,130,133,
+	115,134,127,115,109,135,3,95,95,3,136,3,105,104,3,5,
+	3,137,3,138,139,140,3,3,105,115,3,3,3,15,9,9,
+	3,3,3,3,3,106,3,3,95,3,3,3,136,3,3,139,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,125,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,141,3,3,3,3,139,136,3,3,3,3,3,3,3,3,
+	3,3,3,3,136,142,16,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,22,23,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,22,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,20,20,20,20,20,20,20,20,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	143,143,143,143,143,143,144,143,143,143,143,143,143,143,143,143,
+	143,143,143,143,143,143,143,143,143,143,143,143,143,3,3,3,
+	143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,
+	143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,
+	143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,
+	143,143,143,143,143,145,3,3,3,3,3,3,143,143,143,3,
+	143,143,143,143,143,143,143,143,143,143,146,147,148,143,143,149,
+	150,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,
+	143,143,143,143,143,151,152,143,143,143,143,143,143,143,143,143,
+	143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,
+	3,150,143,143,143,143,143,143,143,143,143,143,150,143,143,143,
+	143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,
+	143,143,143,151,143,143,143,143,143,143,143,143,143,143,143,143,
+	143,143,143,143,143,143,143,143,143,3,3,3,143,143,143,143,
+	143,143,143,143,143,143,143,151,143,143,143,143,143,143,143,143,
+	143,143,9,9,143,143,143,143,143,143,143,143,143,143,143,143,
+	143,143,143,143,143,153,154,143,143,143,143,143,143,143,143,143,
+	143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,
+	143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,
+	143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,
+	143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,
+	143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,
+	143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,
+	143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,
+	143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,
+	143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,
+	143,143,143,155,143,143,143,143,143,143,143,143,143,143,143,143,
+	143,151,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,22,29,20,20,23,
+	3,3,3,3,3,3,3,32,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,23,3,3,3,
+	51,51,22,3,3,3,3,3,156,157,3,31,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	158,3,3,3,3,3,3,3,3,3,3,3,3,70,70,70,
+	70,23,3,3,3,3,3,3,20,20,20,20,23,3,3,22,
+	3,3,3,3,3,3,3,3,3,32,20,23,3,3,3,3,
+	3,22,20,20,66,3,3,3,75,75,75,75,75,75,75,159,
+	39,3,3,3,3,3,3,3,3,3,3,3,22,68,66,66,
+	79,3,3,3,3,3,3,3,3,37,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,24,39,157,53,3,3,
+	22,3,3,78,3,3,3,3,3,3,3,3,3,3,3,31,
+	3,3,3,3,3,3,3,3,3,3,3,3,35,34,31,32,
+	37,3,3,3,3,3,3,3,3,3,156,66,3,160,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,156,44,58,49,3,3,3,3,
+	161,162,162,162,162,162,162,161,162,162,162,162,162,162,161,162,
+	162,162,162,162,162,161,162,162,162,162,162,162,161,162,162,162,
+	162,162,162,161,162,162,162,162,162,162,161,162,162,162,162,162,
+	162,161,162,162,162,162,162,162,161,162,162,162,162,162,162,161,
+	162,162,162,162,162,162,161,162,162,162,162,162,162,161,162,162,
+	162,162,162,162,161,162,162,162,162,162,162,161,162,162,162,162,
+	162,162,161,162,162,162,162,162,162,161,162,162,162,162,162,162,
+	161,162,162,162,162,162,162,161,162,162,162,162,162,162,161,162,
+	162,162,162,162,162,161,162,162,162,162,162,162,161,162,162,162,
+	162,162,162,161,162,162,162,162,162,162,161,162,162,162,162,162,
+	162,161,162,162,162,162,162,162,161,162,162,162,162,162,162,161,
+	162,162,162,162,162,162,161,162,162,162,162,162,162,161,162,162,
+	162,162,162,162,161,162,162,162,162,162,162,161,162,162,162,162,
+	162,162,161,162,162,162,162,162,162,161,162,162,162,162,162,162,
+	161,162,162,162,162,162,162,161,162,162,162,162,162,162,161,162,
+	162,162,162,162,162,161,162,162,162,162,162,162,161,162,162,162,
+	162,162,162,161,162,162,162,162,162,162,161,162,162,162,162,162,
+	162,161,162,162,162,162,162,162,161,162,162,162,162,162,162,161,
+	162,162,162,162,162,162,161,162,162,162,162,162,162,161,162,162,
+	162,162,162,162,161,162,162,162,162,162,162,161,162,162,162,162,
+	162,162,161,162,162,162,162,162,162,161,162,162,162,162,162,162,
+	161,162,162,162,162,162,162,161,162,162,162,162,162,162,161,162,
+	162,162,162,162,162,161,162,162,162,162,162,162,161,162,162,162,
+	162,162,162,161,162,162,162,162,162,162,161,162,162,162,162,162,
+	162,161,162,162,162,162,162,162,161,162,162,162,162,162,162,161,
+	162,162,162,162,162,162,161,162,162,162,162,162,162,161,162,162,
+	162,162,162,162,161,162,162,162,162,162,162,161,162,162,162,162,
+	162,162,161,162,162,162,162,162,162,161,162,162,162,162,162,162,
+	162,162,162,162,162,162,161,162,162,162,162,162,162,161,162,162,
+	162,162,162,162,161,162,162,162,162,162,162,161,162,162,162,162,
+	162,162,161,162,162,162,162,162,162,3,3,3,76,76,76,76,
+	76,163,164,77,77,77,77,77,77,77,77,77,77,77,77,165,
+	9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+	9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+	9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+	9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+	3,3,3,3,3,3,3,51,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	20,20,20,20,143,143,145,3,20,20,20,20,143,143,143,143,
+	143,143,143,143,151,143,143,143,143,151,143,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,90,
+	150,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,
+	143,143,143,143,143,143,143,143,155,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,166,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,143,151,3,3,0,0,167,5,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,37,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,31,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,32,29,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	24,26,3,20,3,3,3,3,3,3,3,3,3,3,29,22,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,26,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,20,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,22,31,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,32,20,20,31,3,3,3,3,3,3,3,3,3,3,3,
+	32,23,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	168,3,3,3,3,3,3,3,3,3,3,3,3,3,20,20,
+	20,29,3,3,3,3,3,3,3,3,3,3,34,31,3,22,
+	87,3,3,3,3,3,3,3,3,3,3,3,83,39,53,169,
+	51,3,3,169,3,3,3,3,3,3,3,3,3,3,3,3,
+	29,3,3,3,3,3,3,3,3,22,20,42,20,31,3,3,
+	3,170,3,3,3,3,3,3,3,3,3,3,22,3,3,3,
+	87,3,3,3,3,3,3,3,3,3,3,3,156,68,20,39,
+	171,3,24,62,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,83,66,74,3,51,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,22,83,20,29,3,3,3,3,3,
+	66,3,3,3,3,3,3,3,3,3,3,3,3,3,22,46,
+	43,48,48,158,3,50,3,3,59,32,20,31,20,31,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,172,20,20,
+	68,173,3,3,3,3,3,51,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,174,20,175,176,
+	74,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,50,68,23,70,80,
+	31,3,3,3,3,3,3,23,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,83,20,39,89,
+	31,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,22,44,20,80,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,24,32,80,20,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,83,20,20,53,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,177,178,179,180,
+	181,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,172,20,32,70,31,79,3,3,3,3,3,3,
+	24,20,29,3,3,3,3,3,3,3,3,3,22,20,182,29,
+	3,22,3,3,24,39,42,3,3,3,3,3,3,3,3,3,
+	3,27,183,20,20,39,23,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,156,20,29,20,80,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,32,20,20,20,20,20,88,20,74,53,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,24,29,51,25,
+	20,38,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,59,184,185,89,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,22,58,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,96,96,30,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,20,31,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,20,29,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,22,172,70,70,70,70,70,70,70,70,70,70,70,
+	70,70,3,22,29,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,143,31,3,3,186,3,3,3,
+	143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,
+	143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,
+	143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,
+	143,143,143,143,143,143,143,143,143,143,143,143,143,143,3,3,
+	143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,
+	143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,
+	143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,
+	143,143,143,143,143,145,3,3,3,3,3,3,3,3,3,3,
+	143,143,155,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,143,150,143,187,
+	143,143,143,143,143,143,143,143,151,3,3,3,3,3,3,3,
+	3,3,3,3,151,3,3,3,3,143,3,3,143,143,143,143,
+	143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,
+	143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,
+	143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,
+	143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,
+	143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,
+	143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,26,96,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	20,20,20,20,20,20,20,20,20,20,20,23,20,20,20,20,
+	20,29,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,188,23,189,190,96,191,20,
+	29,24,20,3,3,3,3,3,3,3,32,23,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	32,31,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	20,20,20,20,20,20,20,20,20,20,20,20,20,29,22,20,
+	20,20,20,20,20,20,20,20,20,20,20,31,3,37,3,3,
+	3,31,3,3,3,3,22,20,24,20,20,20,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	20,29,20,20,20,20,34,20,25,35,29,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,51,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,20,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,20,29,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,20,29,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	115,107,115,115,115,115,115,115,115,115,115,115,115,115,115,115,
+	115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,
+	115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,
+	115,115,115,124,115,115,115,115,115,115,115,115,115,115,115,115,
+	9,9,11,141,9,9,9,9,9,9,9,192,9,9,9,9,
+	9,9,9,9,9,9,9,9,9,9,16,115,193,9,9,194,
+	9,9,9,195,196,121,197,9,9,9,9,198,115,115,115,115,
+	115,115,115,115,115,115,115,115,115,199,200,200,200,200,200,200,
+	201,115,115,115,143,143,202,143,143,143,143,153,203,121,204,115,
+	143,143,205,115,119,115,115,115,121,119,115,115,115,115,115,115,
+	115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,
+	115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,
+	121,121,121,121,121,121,121,121,107,115,115,206,121,207,121,121,
+	121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,208,
+	121,121,121,121,121,115,115,115,121,121,121,121,121,121,121,121,
+	121,121,209,124,121,115,115,115,121,121,121,121,107,107,210,211,
+	121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,209,
+	208,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+	121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+	121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,108,
+	121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,212,
+	3,213,124,209,121,121,121,121,121,121,115,115,115,115,214,115,
+	115,115,115,115,115,215,115,115,115,107,115,115,115,115,115,115,
+	115,115,115,115,115,115,115,115,115,115,115,115,115,115,124,121,
+	121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+	121,121,121,121,3,3,3,3,3,3,3,3,3,3,3,3,
+	121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+	121,119,115,107,209,206,115,206,115,115,124,107,115,121,121,107,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,115,115,115,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,141,115,115,121,121,121,115,107,115,115,115,
+	3,3,3,115,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,115,115,3,3,213,115,3,3,3,3,3,3,3,3,
+	3,3,115,115,3,3,3,3,3,3,3,213,115,115,115,115,
+	115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,
+	3,3,3,121,121,121,121,121,121,121,121,121,121,121,216,121,
+	121,140,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+	121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+	121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+	115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,
+	115,115,115,115,115,115,115,115,115,115,115,115,121,107,121,107,
+	121,209,115,115,121,121,121,121,121,121,121,107,121,121,209,115,
+	121,119,115,115,121,121,119,115,121,121,115,115,121,209,115,115,
+	115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,
+	115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,
+	115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,
+	115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,
+	115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,
+	115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,
+	115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,
+	115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,125,
+	143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,
+	143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,
+	143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,
+	143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,145,
+	217,0,0,0,0,0,0,0,20,20,20,20,20,20,20,20,
+	20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+	20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+	20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+	20,20,20,20,20,20,20,20,20,20,20,20,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+	9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+	9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+	9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,16,
+};
+
+static const uint8_t yas_up_leaf[872]={
+	13,13,13,13,13,13,9,13,13,5,13,13,1,1,1,1,
+	1,1,1,13,1,3,1,1,3,1,1,3,3,57,3,1,
+	1,15,59,1,3,3,3,3,3,1,3,3,3,3,3,1,
+	1,1,3,1,3,1,1,1,1,1,1,3,1,1,3,3,
+	3,3,1,1,3,1,3,1,1,3,1,3,1,3,3,3,
+	16,16,16,16,3,3,1,3,1,1,1,16,16,16,1,1,
+	1,16,16,16,16,16,1,16,1,16,16,1,29,29,29,29,
+	29,29,1,1,16,16,16,1,12,1,1,1,16,1,1,1,
+	1,1,16,16,16,29,1,16,16,1,1,16,16,1,16,16,
+	1,1,1,29,1,16,1,1,16,16,29,16,16,16,16,33,
+	1,1,16,33,16,1,33,33,33,16,16,16,16,33,33,33,
+	33,16,33,33,1,16,33,33,16,1,17,33,16,1,1,33,
+	33,1,1,33,33,16,1,1,1,1,1,17,1,1,16,1,
+	1,16,16,33,33,16,16,1,16,33,1,33,16,1,17,16,
+	1,16,16,17,1,1,17,33,16,33,33,1,1,1,33,33,
+	33,1,33,33,33,1,16,16,16,1,33,16,33,33,17,33,
+	33,1,16,33,1,17,17,1,16,16,33,33,33,16,29,1,
+	33,33,16,16,16,1,16,1,33,33,33,33,33,33,33,17,
+	1,16,1,33,1,16,1,16,16,33,16,16,38,38,38,38,
+	40,40,40,40,44,44,44,44,16,33,1,1,33,1,1,1,
+	16,16,33,16,33,33,16,33,16,16,12,16,33,33,33,16,
+	16,33,33,16,1,33,16,33,16,17,16,16,16,16,33,1,
+	1,33,16,16,33,16,33,16,1,1,1,12,16,20,12,12,
+	13,13,12,12,12,12,12,1,57,1,3,1,1,57,1,1,
+	12,12,12,12,12,13,12,12,1,3,59,1,59,59,59,59,
+	59,59,1,1,1,57,57,1,1,1,58,58,57,2,2,1,
+	57,1,1,1,1,1,1,57,1,58,58,58,58,57,57,57,
+	58,57,57,58,57,57,57,1,3,3,59,3,3,3,57,57,
+	1,1,59,3,59,3,1,1,57,58,58,1,57,57,57,57,
+	57,59,3,57,57,59,57,57,57,57,59,59,58,58,57,57,
+	59,57,59,57,58,58,58,58,59,59,57,59,59,59,59,57,
+	57,57,57,58,57,57,1,1,57,58,57,57,57,57,58,58,
+	57,58,58,59,58,58,59,59,59,59,58,59,58,59,59,59,
+	59,59,58,58,59,58,59,59,57,58,1,1,57,1,57,1,
+	58,1,1,1,57,1,1,57,58,1,58,1,1,1,1,58,
+	58,58,1,58,1,57,57,57,1,58,3,3,2,2,2,2,
+	2,2,1,2,2,2,1,1,2,2,16,16,16,16,18,18,
+	58,2,2,2,2,58,2,1,1,2,2,2,2,2,2,1,
+	1,16,16,2,2,2,2,58,2,58,2,2,2,1,1,1,
+	1,1,1,33,33,16,16,33,33,33,1,1,38,1,1,1,
+	1,33,16,1,50,54,54,54,54,54,54,54,40,40,40,0,
+	0,0,0,44,0,0,0,0,1,1,17,17,13,12,12,12,
+	33,16,33,1,1,29,1,1,1,33,33,1,33,1,29,29,
+	1,33,33,33,16,33,16,1,17,33,33,16,16,33,16,33,
+	33,17,33,16,17,33,33,33,33,33,1,33,33,1,1,16,
+	16,33,16,29,33,29,33,16,16,33,29,16,29,29,16,16,
+	33,33,33,1,16,16,1,33,34,34,1,1,1,2,2,1,
+	1,17,33,16,1,33,17,17,17,17,17,12,12,12,12,16,
+	3,3,1,57,59,59,3,3,3,3,59,59,3,3,58,3,
+	3,58,58,58,58,58,58,3,3,57,57,57,57,57,25,25,
+	25,25,25,25,2,58,58,57,2,2,58,2,2,2,58,58,
+	58,58,58,2,2,57,57,57,57,58,58,58,58,58,57,58,
+	58,57,58,58,58,58,58,57,58,58,58,18,18,18,18,18,
+	58,58,1,1,1,1,57,57,57,57,58,57,57,58,58,57,
+	58,58,58,1,13,12,13,13,
+};
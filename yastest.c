@@ -1,7 +1,6 @@
 #include <ctype.h>
 #include <stdio.h>
 #include <wchar.h>
-#include <locale.h>
 #include <string.h>
 #include <unistd.h>
 #include <inttypes.h>
@@ -26,8 +25,6 @@ int main(void) {
 
 	yascreen *s=yascreen_init(SIZEX,SIZEY);
 
-	setlocale(LC_ALL,"C.UTF-8");
-
 	if (!s) {
 		printf("couldn't init screen %dx%d\n",SIZEX,SIZEY);
 		return 0;
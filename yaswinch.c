@@ -0,0 +1,113 @@
+#define _XOPEN_SOURCE 600 // posix_openpt and friends
+#include <fcntl.h>
+#include <stdio.h>
+#include <signal.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+
+#include <yascreen.h>
+
+// checks that an application SIGWINCH handler of either kind still fires with built-in SIGWINCH handling enabled
+
+static FILE *res; // results go to the original output, stdout is the pseudo terminal
+static volatile sig_atomic_t plain; // calls to the plain handler
+static volatile sig_atomic_t info; // calls to the SA_SIGINFO handler
+
+static void winch_plain(int sig) {
+	if (sig==SIGWINCH)
+		plain++;
+}
+
+static void winch_info(int sig,siginfo_t *si,void *ctx) {
+	(void)ctx;
+	if (sig==SIGWINCH&&si&&si->si_signo==SIGWINCH)
+		info++;
+}
+
+static int check(int siginfo) {
+	const char *name=siginfo?"SA_SIGINFO":"sa_handler";
+	volatile sig_atomic_t *cnt=siginfo?&info:&plain;
+	struct sigaction sa,cur;
+	yascreen *s;
+	int key;
+
+	memset(&sa,0,sizeof sa);
+	if (siginfo) {
+		sa.sa_sigaction=winch_info;
+		sa.sa_flags=SA_SIGINFO;
+	} else
+		sa.sa_handler=winch_plain;
+	sigemptyset(&sa.sa_mask);
+	sigaction(SIGWINCH,&sa,NULL);
+	*cnt=0;
+
+	s=yascreen_init(80,25);
+	if (!s) {
+		fprintf(res,"%s: couldn't init screen\n",name);
+		return 1;
+	}
+	if (yascreen_set_winch(s,1)) {
+		fprintf(res,"%s: couldn't enable SIGWINCH handling\n",name);
+		yascreen_free(s);
+		return 1;
+	}
+	raise(SIGWINCH);
+	if (*cnt!=1) {
+		fprintf(res,"%s: application handler called %d times with built-in handling, expected 1\n",name,(int)*cnt);
+		yascreen_free(s);
+		return 1;
+	}
+	key=yascreen_getch_to(s,1000); // reported once the signals settle
+	if (key!=YAS_SCREEN_SIZE) {
+		fprintf(res,"%s: got key %x instead of YAS_SCREEN_SIZE\n",name,key);
+		yascreen_free(s);
+		return 1;
+	}
+	yascreen_set_winch(s,0);
+	yascreen_free(s);
+
+	sigaction(SIGWINCH,NULL,&cur);
+	if (siginfo?!(cur.sa_flags&SA_SIGINFO)||cur.sa_sigaction!=winch_info:(cur.sa_flags&SA_SIGINFO)||cur.sa_handler!=winch_plain) {
+		fprintf(res,"%s: application handler is not restored\n",name);
+		return 1;
+	}
+	raise(SIGWINCH);
+	if (*cnt!=2) {
+		fprintf(res,"%s: application handler called %d times after restore, expected 2\n",name,(int)*cnt);
+		return 1;
+	}
+	fprintf(res,"%s: ok\n",name);
+	return 0;
+}
+
+int main(void) {
+	struct winsize ws={0};
+	int m,t,rv;
+
+	// built-in handling works only for a terminal, give it one that does not need a user
+	m=posix_openpt(O_RDWR|O_NOCTTY);
+	if (m<0||grantpt(m)||unlockpt(m)||(t=open(ptsname(m),O_RDWR|O_NOCTTY))<0) {
+		fprintf(res,"couldn't open a pseudo terminal\n");
+		return 1;
+	}
+	ws.ws_col=80;
+	ws.ws_row=25;
+	ioctl(t,TIOCSWINSZ,&ws); // a terminal without size gives no YAS_SCREEN_SIZE
+	fflush(stdout);
+	rv=dup(STDOUT_FILENO);
+	if (rv<0||dup2(t,STDIN_FILENO)<0||dup2(t,STDOUT_FILENO)<0) {
+		fprintf(stderr,"couldn't redirect to the pseudo terminal\n");
+		return 1;
+	}
+	if (!(res=fdopen(rv,"w"))) {
+		fprintf(stderr,"couldn't open the original output\n");
+		return 1;
+	}
+
+	rv=check(0);
+	rv|=check(1);
+	fclose(res);
+	return rv;
+}